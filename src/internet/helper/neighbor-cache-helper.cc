@@ -18,6 +18,10 @@
 #include "ns3/ptr.h"
 #include "ns3/simulator.h"
 
+#include <map>
+#include <unordered_map>
+#include <vector>
+
 namespace ns3
 {
 
@@ -49,65 +53,217 @@ void
 NeighborCacheHelper::PopulateNeighborCache(Ptr<Channel> channel) const
 {
     NS_LOG_FUNCTION(this << channel);
-    for (std::size_t i = 0; i < channel->GetNDevices(); ++i)
+    // Resolve the IP interfaces of the devices attached to the channel once, instead of once
+    // per pair of devices
+    std::size_t nDevices = channel->GetNDevices();
+    std::vector<Ptr<Ipv4Interface>> ipv4Interfaces(nDevices);
+    std::vector<Ptr<Ipv6Interface>> ipv6Interfaces(nDevices);
+    for (std::size_t i = 0; i < nDevices; ++i)
     {
         Ptr<NetDevice> netDevice = channel->GetDevice(i);
         Ptr<Node> node = netDevice->GetNode();
 
-        int32_t ipv4InterfaceIndex = -1;
-        if (node->GetObject<Ipv4>())
+        Ptr<Ipv4L3Protocol> ipv4 = node->GetObject<Ipv4L3Protocol>();
+        if (ipv4)
         {
-            ipv4InterfaceIndex = node->GetObject<Ipv4>()->GetInterfaceForDevice(netDevice);
+            int32_t ipv4InterfaceIndex = ipv4->GetInterfaceForDevice(netDevice);
+            if (ipv4InterfaceIndex != -1)
+            {
+                ipv4Interfaces[i] = ipv4->GetInterface(ipv4InterfaceIndex);
+            }
         }
-        int32_t ipv6InterfaceIndex = -1;
-        if (node->GetObject<Ipv6>())
+        Ptr<Ipv6L3Protocol> ipv6 = node->GetObject<Ipv6L3Protocol>();
+        if (ipv6)
         {
-            ipv6InterfaceIndex = node->GetObject<Ipv6>()->GetInterfaceForDevice(netDevice);
+            int32_t ipv6InterfaceIndex = ipv6->GetInterfaceForDevice(netDevice);
+            if (ipv6InterfaceIndex != -1)
+            {
+                ipv6Interfaces[i] = ipv6->GetInterface(ipv6InterfaceIndex);
+            }
         }
+    }
+    PopulateChannelEntriesIpv4(ipv4Interfaces);
+    PopulateChannelEntriesIpv6(ipv6Interfaces);
+}
 
-        for (std::size_t j = 0; j < channel->GetNDevices(); ++j)
+void
+NeighborCacheHelper::PopulateChannelEntriesIpv4(
+    const std::vector<Ptr<Ipv4Interface>>& interfaces) const
+{
+    NS_LOG_FUNCTION(this);
+    // An address of the channel and the index of the interface owning it
+    using Neighbor = std::pair<Ipv4Address, std::size_t>;
+    // The addresses of the channel, by network address, for each network mask in use
+    std::map<uint32_t, std::unordered_map<uint32_t, std::vector<Neighbor>>> subnets;
+
+    std::size_t nInterfaces = 0;
+    for (const auto& interface : interfaces)
+    {
+        if (interface)
         {
-            Ptr<NetDevice> neighborDevice = channel->GetDevice(j);
-            Ptr<Node> neighborNode = neighborDevice->GetNode();
+            ++nInterfaces;
+            for (uint32_t n = 0; n < interface->GetNAddresses(); ++n)
+            {
+                subnets[interface->GetAddress(n).GetMask().Get()];
+            }
+        }
+    }
+    if (nInterfaces < 2)
+    {
+        return;
+    }
+    for (auto& [mask, networks] : subnets)
+    {
+        for (std::size_t i = 0; i < interfaces.size(); ++i)
+        {
+            if (!interfaces[i])
+            {
+                continue;
+            }
+            for (uint32_t m = 0; m < interfaces[i]->GetNAddresses(); ++m)
+            {
+                Ipv4Address address = interfaces[i]->GetAddress(m).GetLocal();
+                networks[address.Get() & mask].emplace_back(address, i);
+            }
+        }
+    }
 
-            int32_t ipv4NeighborInterfaceIndex = -1;
-            if (neighborNode->GetObject<Ipv4>())
+    for (std::size_t i = 0; i < interfaces.size(); ++i)
+    {
+        Ptr<Ipv4Interface> ipv4Interface = interfaces[i];
+        if (!ipv4Interface)
+        {
+            continue;
+        }
+        if (m_dynamicNeighborCache)
+        {
+            ipv4Interface->RemoveAddressCallback(
+                MakeCallback(&NeighborCacheHelper::UpdateCacheByIpv4AddressRemoved, this));
+            if (m_globalNeighborCache)
             {
-                ipv4NeighborInterfaceIndex =
-                    neighborNode->GetObject<Ipv4>()->GetInterfaceForDevice(neighborDevice);
+                ipv4Interface->AddAddressCallback(
+                    MakeCallback(&NeighborCacheHelper::UpdateCacheByIpv4AddressAdded, this));
             }
-            int32_t ipv6NeighborInterfaceIndex = -1;
-            if (neighborNode->GetObject<Ipv6>())
+        }
+        for (uint32_t n = 0; n < ipv4Interface->GetNAddresses(); ++n)
+        {
+            Ipv4InterfaceAddress netDeviceIfAddr = ipv4Interface->GetAddress(n);
+            uint32_t mask = netDeviceIfAddr.GetMask().Get();
+            const auto& networks = subnets.at(mask);
+            auto it = networks.find(netDeviceIfAddr.GetLocal().Get() & mask);
+            NS_ASSERT_MSG(it != networks.end(), "The interface's own address is not indexed");
+            for (const auto& [neighborAddress, j] : it->second)
             {
-                ipv6NeighborInterfaceIndex =
-                    neighborNode->GetObject<Ipv6>()->GetInterfaceForDevice(neighborDevice);
+                if (j != i)
+                {
+                    // Add Arp entry of neighbor interface to current interface's Arp cache
+                    AddEntry(ipv4Interface,
+                             neighborAddress,
+                             interfaces[j]->GetDevice()->GetAddress());
+                }
             }
+        }
+    }
+}
 
-            if (neighborDevice != netDevice)
+void
+NeighborCacheHelper::PopulateChannelEntriesIpv6(
+    const std::vector<Ptr<Ipv6Interface>>& interfaces) const
+{
+    NS_LOG_FUNCTION(this);
+    // An address of the channel and the index of the interface owning it
+    using Neighbor = std::pair<Ipv6Address, std::size_t>;
+    // The addresses of the channel, by network address, for each prefix length in use
+    std::map<uint8_t, std::unordered_map<Ipv6Address, std::vector<Neighbor>, Ipv6AddressHash>>
+        subnets;
+
+    // Link-local and host addresses are not matched, the link-local address of a neighbor is
+    // added along with its global addresses
+    auto isGlobal = [](const Ipv6InterfaceAddress& ifAddr) {
+        return ifAddr.GetScope() != Ipv6InterfaceAddress::LINKLOCAL &&
+               ifAddr.GetScope() != Ipv6InterfaceAddress::HOST;
+    };
+
+    std::size_t nInterfaces = 0;
+    for (const auto& interface : interfaces)
+    {
+        if (interface)
+        {
+            ++nInterfaces;
+            for (uint32_t n = 0; n < interface->GetNAddresses(); ++n)
             {
-                if (ipv4InterfaceIndex != -1)
+                if (isGlobal(interface->GetAddress(n)))
                 {
-                    Ptr<Ipv4Interface> ipv4Interface =
-                        node->GetObject<Ipv4L3Protocol>()->GetInterface(ipv4InterfaceIndex);
-                    if (ipv4NeighborInterfaceIndex != -1)
-                    {
-                        Ptr<Ipv4Interface> ipv4NeighborInterface =
-                            neighborNode->GetObject<Ipv4L3Protocol>()->GetInterface(
-                                ipv4NeighborInterfaceIndex);
-                        PopulateNeighborEntriesIpv4(ipv4Interface, ipv4NeighborInterface);
-                    }
+                    subnets[interface->GetAddress(n).GetPrefix().GetPrefixLength()];
                 }
-                if (ipv6InterfaceIndex != -1)
+            }
+        }
+    }
+    if (nInterfaces < 2)
+    {
+        return;
+    }
+    for (auto& [prefixLength, networks] : subnets)
+    {
+        Ipv6Prefix prefix(prefixLength);
+        for (std::size_t i = 0; i < interfaces.size(); ++i)
+        {
+            if (!interfaces[i])
+            {
+                continue;
+            }
+            for (uint32_t m = 0; m < interfaces[i]->GetNAddresses(); ++m)
+            {
+                Ipv6InterfaceAddress ifAddr = interfaces[i]->GetAddress(m);
+                if (isGlobal(ifAddr))
                 {
-                    Ptr<Ipv6Interface> ipv6Interface =
-                        node->GetObject<Ipv6L3Protocol>()->GetInterface(ipv6InterfaceIndex);
-                    if (ipv6NeighborInterfaceIndex != -1)
-                    {
-                        Ptr<Ipv6Interface> ipv6NeighborInterface =
-                            neighborNode->GetObject<Ipv6L3Protocol>()->GetInterface(
-                                ipv6NeighborInterfaceIndex);
-                        PopulateNeighborEntriesIpv6(ipv6Interface, ipv6NeighborInterface);
-                    }
+                    Ipv6Address address = ifAddr.GetAddress();
+                    networks[address.CombinePrefix(prefix)].emplace_back(address, i);
+                }
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < interfaces.size(); ++i)
+    {
+        Ptr<Ipv6Interface> ipv6Interface = interfaces[i];
+        if (!ipv6Interface)
+        {
+            continue;
+        }
+        if (m_dynamicNeighborCache)
+        {
+            ipv6Interface->RemoveAddressCallback(
+                MakeCallback(&NeighborCacheHelper::UpdateCacheByIpv6AddressRemoved, this));
+            if (m_globalNeighborCache)
+            {
+                ipv6Interface->AddAddressCallback(
+                    MakeCallback(&NeighborCacheHelper::UpdateCacheByIpv6AddressAdded, this));
+            }
+        }
+        for (uint32_t n = 0; n < ipv6Interface->GetNAddresses(); ++n)
+        {
+            Ipv6InterfaceAddress netDeviceIfAddr = ipv6Interface->GetAddress(n);
+            if (!isGlobal(netDeviceIfAddr))
+            {
+                NS_LOG_LOGIC("Skip the LINKLOCAL or LOCALHOST interface " << netDeviceIfAddr);
+                continue;
+            }
+            Ipv6Prefix prefix(netDeviceIfAddr.GetPrefix().GetPrefixLength());
+            const auto& networks = subnets.at(prefix.GetPrefixLength());
+            auto it = networks.find(netDeviceIfAddr.GetAddress().CombinePrefix(prefix));
+            NS_ASSERT_MSG(it != networks.end(), "The interface's own address is not indexed");
+            for (const auto& [neighborAddress, j] : it->second)
+            {
+                if (j != i)
+                {
+                    Ptr<NetDevice> neighborDevice = interfaces[j]->GetDevice();
+                    // Add neighbor's Ndisc entries of global address and linklocal address to
+                    // current interface's Ndisc cache
+                    AddEntry(ipv6Interface, neighborAddress, neighborDevice->GetAddress());
+                    AddEntry(ipv6Interface,
+                             interfaces[j]->GetLinkLocalAddress().GetAddress(),
+                             neighborDevice->GetAddress());
                 }
             }
         }
@@ -25,6 +25,8 @@
 #include "ns3/net-device-container.h"
 #include "ns3/node-list.h"
 
+#include <vector>
+
 namespace ns3
 {
 
@@ -110,6 +112,28 @@ class NeighborCacheHelper
     void PopulateNeighborEntriesIpv6(Ptr<Ipv6Interface> ipv6Interface,
                                      Ptr<Ipv6Interface> neighborDeviceInterface) const;
 
+    /**
+     * @brief Populate the neighbor ARP entries of all the IPv4 interfaces attached to a channel.
+     *
+     * The addresses of the channel are indexed by subnet first, so that each interface finds
+     * its neighbors with one lookup per address rather than by scanning every other interface.
+     *
+     * @param interfaces the Ipv4Interface of each device of the channel, null if none
+     */
+    void PopulateChannelEntriesIpv4(const std::vector<Ptr<Ipv4Interface>>& interfaces) const;
+
+    /**
+     * @brief Populate the neighbor NDISC entries of all the IPv6 interfaces attached to a
+     * channel.
+     *
+     * The global addresses of the channel are indexed by prefix first, so that each interface
+     * finds its neighbors with one lookup per address rather than by scanning every other
+     * interface.
+     *
+     * @param interfaces the Ipv6Interface of each device of the channel, null if none
+     */
+    void PopulateChannelEntriesIpv6(const std::vector<Ptr<Ipv6Interface>>& interfaces) const;
+
     /**
      * @brief Add an auto_generated entry to the ARP cache of an interface.
      * @param netDeviceInterface the Ipv4Interface that ARP cache belongs to
@@ -19,6 +19,8 @@
 #include "ns3/trace-source-accessor.h"
 #include "ns3/uinteger.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -186,11 +188,9 @@ void
 ArpCache::HandleWaitReplyTimeout()
 {
     NS_LOG_FUNCTION(this);
-    ArpCache::Entry* entry;
     bool restartWaitReplyTimer = false;
-    for (auto i = m_arpCache.begin(); i != m_arpCache.end(); i++)
+    for (ArpCache::Entry* entry : GetSortedEntries())
     {
-        entry = (*i).second;
         if (entry != nullptr && entry->IsWaitReply())
         {
             if (entry->GetRetries() < m_maxRetries)
@@ -253,9 +253,9 @@ ArpCache::PrintArpCache(Ptr<OutputStreamWrapper> stream)
     NS_LOG_FUNCTION(this << stream);
     std::ostream* os = stream->GetStream();
 
-    for (auto i = m_arpCache.begin(); i != m_arpCache.end(); i++)
+    for (ArpCache::Entry* entry : GetSortedEntries())
     {
-        *os << i->first << " dev ";
+        *os << entry->GetIpv4Address() << " dev ";
         std::string found = Names::FindName(m_device);
         if (!Names::FindName(m_device).empty())
         {
@@ -266,21 +266,21 @@ ArpCache::PrintArpCache(Ptr<OutputStreamWrapper> stream)
             *os << static_cast<int>(m_device->GetIfIndex());
         }
 
-        *os << " lladdr " << i->second->GetMacAddress();
+        *os << " lladdr " << entry->GetMacAddress();
 
-        if (i->second->IsAlive())
+        if (entry->IsAlive())
         {
             *os << " REACHABLE\n";
         }
-        else if (i->second->IsWaitReply())
+        else if (entry->IsWaitReply())
         {
             *os << " DELAY\n";
         }
-        else if (i->second->IsPermanent())
+        else if (entry->IsPermanent())
         {
             *os << " PERMANENT\n";
         }
-        else if (i->second->IsAutoGenerated())
+        else if (entry->IsAutoGenerated())
         {
             *os << " STATIC_AUTOGENERATED\n";
         }
@@ -314,9 +314,8 @@ ArpCache::LookupInverse(Address to)
     NS_LOG_FUNCTION(this << to);
 
     std::list<ArpCache::Entry*> entryList;
-    for (auto i = m_arpCache.begin(); i != m_arpCache.end(); i++)
+    for (const auto& [address, entry] : m_arpCache)
     {
-        ArpCache::Entry* entry = (*i).second;
         if (entry->GetMacAddress() == to)
         {
             entryList.push_back(entry);
@@ -354,19 +353,32 @@ ArpCache::Remove(ArpCache::Entry* entry)
 {
     NS_LOG_FUNCTION(this << entry);
 
-    for (auto i = m_arpCache.begin(); i != m_arpCache.end(); i++)
+    auto it = m_arpCache.find(entry->GetIpv4Address());
+    if (it != m_arpCache.end() && it->second == entry)
     {
-        if ((*i).second == entry)
-        {
-            m_arpCache.erase(i);
-            entry->ClearPendingPacket(); // clear the pending packets for entry's ipaddress
-            delete entry;
-            return;
-        }
+        m_arpCache.erase(it);
+        entry->ClearPendingPacket(); // clear the pending packets for entry's ipaddress
+        delete entry;
+        return;
     }
     NS_LOG_WARN("Entry not found in this ARP Cache");
 }
 
+std::vector<ArpCache::Entry*>
+ArpCache::GetSortedEntries() const
+{
+    std::vector<ArpCache::Entry*> entries;
+    entries.reserve(m_arpCache.size());
+    for (const auto& [address, entry] : m_arpCache)
+    {
+        entries.push_back(entry);
+    }
+    std::sort(entries.begin(), entries.end(), [](ArpCache::Entry* a, ArpCache::Entry* b) {
+        return a->GetIpv4Address() < b->GetIpv4Address();
+    });
+    return entries;
+}
+
 ArpCache::Entry::Entry(ArpCache* arp)
     : m_arp(arp),
       m_state(ALIVE),
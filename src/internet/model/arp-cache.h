@@ -21,8 +21,9 @@
 #include "ns3/traced-callback.h"
 
 #include <list>
-#include <map>
 #include <stdint.h>
+#include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -310,14 +311,24 @@ class ArpCache : public Object
     /**
      * @brief ARP Cache container
      */
-    typedef std::map<Ipv4Address, ArpCache::Entry*> Cache;
+    typedef std::unordered_map<Ipv4Address, ArpCache::Entry*, Ipv4AddressHash> Cache;
     /**
      * @brief ARP Cache container iterator
      */
-    typedef std::map<Ipv4Address, ArpCache::Entry*>::iterator CacheI;
+    typedef Cache::iterator CacheI;
 
     void DoDispose() override;
 
+    /**
+     * @brief Get the entries of the cache sorted by IPv4 address.
+     *
+     * The cache is a hash table, so this is used wherever the iteration order is observable
+     * (printed tables, retransmitted requests) to keep it independent of the table layout.
+     *
+     * @return the cache entries, in increasing IPv4 address order
+     */
+    std::vector<ArpCache::Entry*> GetSortedEntries() const;
+
     Ptr<NetDevice> m_device;        //!< NetDevice associated with the cache
     Ptr<Ipv4Interface> m_interface; //!< Ipv4Interface associated with the cache
     Time m_aliveTimeout;            //!< cache alive state timeout
@@ -13,6 +13,8 @@
 
 #include "ns3/log.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -29,36 +31,150 @@ Ipv4EndPointDemux::Ipv4EndPointDemux()
 Ipv4EndPointDemux::~Ipv4EndPointDemux()
 {
     NS_LOG_FUNCTION(this);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    for (auto& [port, endPoints] : m_portMap)
     {
-        Ipv4EndPoint* endPoint = *i;
-        delete endPoint;
+        for (auto endPoint : endPoints)
+        {
+            endPoint->m_demux = nullptr;
+            delete endPoint;
+        }
     }
-    m_endPoints.clear();
+    m_portMap.clear();
+    m_tupleMap.clear();
 }
 
 bool
-Ipv4EndPointDemux::LookupPortLocal(uint16_t port)
+Ipv4EndPointDemux::FourTuple::operator==(const FourTuple& other) const
 {
-    NS_LOG_FUNCTION(this << port);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    return localPort == other.localPort && peerPort == other.peerPort &&
+           localAddress == other.localAddress && peerAddress == other.peerAddress;
+}
+
+std::size_t
+Ipv4EndPointDemux::FourTupleHash::operator()(const FourTuple& tuple) const
+{
+    uint64_t addresses =
+        (static_cast<uint64_t>(tuple.localAddress.Get()) << 32) | tuple.peerAddress.Get();
+    uint32_t ports = (static_cast<uint32_t>(tuple.localPort) << 16) | tuple.peerPort;
+    std::size_t h = std::hash<uint64_t>()(addresses);
+    return h ^ (std::hash<uint32_t>()(ports) + 0x9e3779b9 + (h << 6) + (h >> 2));
+}
+
+void
+Ipv4EndPointDemux::Insert(Ipv4EndPoint* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+    endPoint->m_demux = this;
+    m_portMap[endPoint->GetLocalPort()].push_back(endPoint);
+    m_nEndPoints++;
+    Reindex(endPoint);
+}
+
+void
+Ipv4EndPointDemux::Remove(Ipv4EndPoint* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+    Unindex(endPoint);
+    auto it = m_portMap.find(endPoint->GetLocalPort());
+    if (it == m_portMap.end())
+    {
+        return;
+    }
+    it->second.remove(endPoint);
+    if (it->second.empty())
+    {
+        m_portMap.erase(it);
+    }
+    m_nEndPoints--;
+    endPoint->m_demux = nullptr;
+}
+
+void
+Ipv4EndPointDemux::Unindex(Ipv4EndPoint* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+    auto it = m_tupleMap.find({endPoint->GetLocalAddress(),
+                               endPoint->GetLocalPort(),
+                               endPoint->GetPeerAddress(),
+                               endPoint->GetPeerPort()});
+    if (it == m_tupleMap.end())
+    {
+        return;
+    }
+    it->second.remove(endPoint);
+    if (it->second.empty())
+    {
+        m_tupleMap.erase(it);
+    }
+}
+
+void
+Ipv4EndPointDemux::Reindex(Ipv4EndPoint* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+    m_tupleMap[{endPoint->GetLocalAddress(),
+                endPoint->GetLocalPort(),
+                endPoint->GetPeerAddress(),
+                endPoint->GetPeerPort()}]
+        .push_back(endPoint);
+}
+
+void
+Ipv4EndPointDemux::LookupTuple(const FourTuple& tuple,
+                               Ptr<Ipv4Interface> incomingInterface,
+                               EndPoints& endPoints) const
+{
+    auto it = m_tupleMap.find(tuple);
+    if (it == m_tupleMap.end())
     {
-        if ((*i)->GetLocalPort() == port)
+        return;
+    }
+    for (auto endP : it->second)
+    {
+        NS_LOG_DEBUG("Looking at endpoint dport="
+                     << endP->GetLocalPort() << " daddr=" << endP->GetLocalAddress()
+                     << " sport=" << endP->GetPeerPort() << " saddr=" << endP->GetPeerAddress());
+
+        if (!endP->IsRxEnabled())
         {
-            return true;
+            NS_LOG_LOGIC("Skipping endpoint " << &endP
+                                              << " because endpoint can not receive packets");
+            continue;
+        }
+        if (endP->GetBoundNetDevice())
+        {
+            if (!incomingInterface || endP->GetBoundNetDevice() != incomingInterface->GetDevice())
+            {
+                NS_LOG_LOGIC("Skipping endpoint "
+                             << &endP << " because endpoint is bound to specific device and"
+                             << endP->GetBoundNetDevice() << " does not match packet device");
+                continue;
+            }
         }
+        endPoints.push_back(endP);
     }
-    return false;
+}
+
+bool
+Ipv4EndPointDemux::LookupPortLocal(uint16_t port)
+{
+    NS_LOG_FUNCTION(this << port);
+    return m_portMap.find(port) != m_portMap.end();
 }
 
 bool
 Ipv4EndPointDemux::LookupLocal(Ptr<NetDevice> boundNetDevice, Ipv4Address addr, uint16_t port)
 {
     NS_LOG_FUNCTION(this << addr << port);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    auto it = m_portMap.find(port);
+    if (it == m_portMap.end())
     {
-        if ((*i)->GetLocalPort() == port && (*i)->GetLocalAddress() == addr &&
-            (*i)->GetBoundNetDevice() == boundNetDevice)
+        return false;
+    }
+    for (auto endPoint : it->second)
+    {
+        if (endPoint->GetLocalAddress() == addr &&
+            endPoint->GetBoundNetDevice() == boundNetDevice)
         {
             return true;
         }
@@ -77,8 +193,8 @@ Ipv4EndPointDemux::Allocate()
         return nullptr;
     }
     auto endPoint = new Ipv4EndPoint(Ipv4Address::GetAny(), port);
-    m_endPoints.push_back(endPoint);
-    NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
+    Insert(endPoint);
+    NS_LOG_DEBUG("Now have >>" << m_nEndPoints << "<< endpoints.");
     return endPoint;
 }
 
@@ -93,8 +209,8 @@ Ipv4EndPointDemux::Allocate(Ipv4Address address)
         return nullptr;
     }
     auto endPoint = new Ipv4EndPoint(address, port);
-    m_endPoints.push_back(endPoint);
-    NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
+    Insert(endPoint);
+    NS_LOG_DEBUG("Now have >>" << m_nEndPoints << "<< endpoints.");
     return endPoint;
 }
 
@@ -116,8 +232,8 @@ Ipv4EndPointDemux::Allocate(Ptr<NetDevice> boundNetDevice, Ipv4Address address,
         return nullptr;
     }
     auto endPoint = new Ipv4EndPoint(address, port);
-    m_endPoints.push_back(endPoint);
-    NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
+    Insert(endPoint);
+    NS_LOG_DEBUG("Now have >>" << m_nEndPoints << "<< endpoints.");
     return endPoint;
 }
 
@@ -129,21 +245,24 @@ Ipv4EndPointDemux::Allocate(Ptr<NetDevice> boundNetDevice,
                             uint16_t peerPort)
 {
     NS_LOG_FUNCTION(this << localAddress << localPort << peerAddress << peerPort << boundNetDevice);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    auto it = m_tupleMap.find({localAddress, localPort, peerAddress, peerPort});
+    if (it != m_tupleMap.end())
     {
-        if ((*i)->GetLocalPort() == localPort && (*i)->GetLocalAddress() == localAddress &&
-            (*i)->GetPeerPort() == peerPort && (*i)->GetPeerAddress() == peerAddress &&
-            ((*i)->GetBoundNetDevice() == boundNetDevice || !(*i)->GetBoundNetDevice()))
+        for (auto endPoint : it->second)
         {
-            NS_LOG_WARN("Duplicated endpoint.");
-            return nullptr;
+            if (endPoint->GetBoundNetDevice() == boundNetDevice ||
+                !endPoint->GetBoundNetDevice())
+            {
+                NS_LOG_WARN("Duplicated endpoint.");
+                return nullptr;
+            }
         }
     }
     auto endPoint = new Ipv4EndPoint(localAddress, localPort);
     endPoint->SetPeer(peerAddress, peerPort);
-    m_endPoints.push_back(endPoint);
+    Insert(endPoint);
 
-    NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
+    NS_LOG_DEBUG("Now have >>" << m_nEndPoints << "<< endpoints.");
 
     return endPoint;
 }
@@ -152,15 +271,12 @@ void
 Ipv4EndPointDemux::DeAllocate(Ipv4EndPoint* endPoint)
 {
     NS_LOG_FUNCTION(this << endPoint);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    if (endPoint->m_demux != this)
     {
-        if (*i == endPoint)
-        {
-            delete endPoint;
-            m_endPoints.erase(i);
-            break;
-        }
+        return;
     }
+    Remove(endPoint);
+    delete endPoint;
 }
 
 /*
@@ -172,10 +288,9 @@ Ipv4EndPointDemux::GetAllEndPoints()
     NS_LOG_FUNCTION(this);
     EndPoints ret;
 
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    for (const auto& [port, endPoints] : m_portMap)
     {
-        Ipv4EndPoint* endP = *i;
-        ret.push_back(endP);
+        ret.insert(ret.end(), endPoints.begin(), endPoints.end());
     }
     return ret;
 }
@@ -194,157 +309,69 @@ Ipv4EndPointDemux::Lookup(Ipv4Address daddr,
 {
     NS_LOG_FUNCTION(this << daddr << dport << saddr << sport << incomingInterface);
 
-    EndPoints retval1; // Matches exact on local port, wildcards on others
-    EndPoints retval2; // Matches exact on local port/adder, wildcards on others
-    EndPoints retval3; // Matches all but local address
-    EndPoints retval4; // Exact match on all 4
-
     NS_LOG_DEBUG("Looking up endpoint for destination address " << daddr << ":" << dport);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    if (m_portMap.find(dport) == m_portMap.end())
     {
-        Ipv4EndPoint* endP = *i;
-
-        NS_LOG_DEBUG("Looking at endpoint dport="
-                     << endP->GetLocalPort() << " daddr=" << endP->GetLocalAddress()
-                     << " sport=" << endP->GetPeerPort() << " saddr=" << endP->GetPeerAddress());
-
-        if (!endP->IsRxEnabled())
-        {
-            NS_LOG_LOGIC("Skipping endpoint " << &endP
-                                              << " because endpoint can not receive packets");
-            continue;
-        }
-
-        if (endP->GetLocalPort() != dport)
-        {
-            NS_LOG_LOGIC("Skipping endpoint " << &endP << " because endpoint dport "
-                                              << endP->GetLocalPort()
-                                              << " does not match packet dport " << dport);
-            continue;
-        }
-        if (endP->GetBoundNetDevice())
-        {
-            if (endP->GetBoundNetDevice() != incomingInterface->GetDevice())
-            {
-                NS_LOG_LOGIC("Skipping endpoint "
-                             << &endP << " because endpoint is bound to specific device and"
-                             << endP->GetBoundNetDevice() << " does not match packet device "
-                             << incomingInterface->GetDevice());
-                continue;
-            }
-        }
-
-        bool localAddressMatchesExact = false;
-        bool localAddressIsAny = false;
-        bool localAddressIsSubnetAny = false;
-
-        // We have 3 cases:
-        // 1) Exact local / destination address match
-        // 2) Local endpoint bound to Any -> matches anything
-        // 3) Local endpoint bound to x.y.z.0 -> matches Subnet-directed broadcast packet (e.g.,
-        // x.y.z.255 in a /24 net) and direct destination match.
-
-        if (endP->GetLocalAddress() == daddr)
-        {
-            // Case 1:
-            localAddressMatchesExact = true;
-        }
-        else if (endP->GetLocalAddress() == Ipv4Address::GetAny())
-        {
-            // Case 2:
-            localAddressIsAny = true;
-        }
-        else
-        {
-            // Case 3:
-            for (uint32_t i = 0; i < incomingInterface->GetNAddresses(); i++)
-            {
-                Ipv4InterfaceAddress addr = incomingInterface->GetAddress(i);
-
-                Ipv4Address addrNetpart = addr.GetLocal().CombineMask(addr.GetMask());
-                if (endP->GetLocalAddress() == addrNetpart)
-                {
-                    NS_LOG_LOGIC("Endpoint is SubnetDirectedAny "
-                                 << endP->GetLocalAddress() << "/"
-                                 << addr.GetMask().GetPrefixLength());
-
-                    Ipv4Address daddrNetPart = daddr.CombineMask(addr.GetMask());
-                    if (addrNetpart == daddrNetPart)
-                    {
-                        localAddressIsSubnetAny = true;
-                    }
-                }
-            }
-
-            // if no match here, keep looking
-            if (!localAddressIsSubnetAny)
-            {
-                continue;
-            }
-        }
+        NS_LOG_LOGIC("No endpoint bound to port " << dport);
+        return EndPoints();
+    }
 
-        bool remotePortMatchesExact = endP->GetPeerPort() == sport;
-        bool remotePortMatchesWildCard = endP->GetPeerPort() == 0;
-        bool remoteAddressMatchesExact = endP->GetPeerAddress() == saddr;
-        bool remoteAddressMatchesWildCard = endP->GetPeerAddress() == Ipv4Address::GetAny();
+    // The local part of an endpoint matches the destination of the packet in 3 cases:
+    // 1) Exact local / destination address match
+    // 2) Local endpoint bound to Any -> matches anything
+    // 3) Local endpoint bound to x.y.z.0 -> matches Subnet-directed broadcast packet (e.g.,
+    // x.y.z.255 in a /24 net) and direct destination match.
+    // Cases 2 and 3 are the local wildcards.
+    std::list<Ipv4Address> localWildcards;
+    if (daddr != Ipv4Address::GetAny())
+    {
+        localWildcards.push_back(Ipv4Address::GetAny());
+    }
+    for (uint32_t i = 0; incomingInterface && i < incomingInterface->GetNAddresses(); i++)
+    {
+        Ipv4InterfaceAddress addr = incomingInterface->GetAddress(i);
 
-        // If remote does not match either with exact or wildcard,
-        // skip this one
-        if (!(remotePortMatchesExact || remotePortMatchesWildCard))
+        Ipv4Address addrNetpart = addr.GetLocal().CombineMask(addr.GetMask());
+        if (addrNetpart == daddr || addrNetpart == Ipv4Address::GetAny() ||
+            addrNetpart != daddr.CombineMask(addr.GetMask()))
         {
             continue;
         }
-        if (!(remoteAddressMatchesExact || remoteAddressMatchesWildCard))
+        if (std::find(localWildcards.begin(), localWildcards.end(), addrNetpart) ==
+            localWildcards.end())
         {
-            continue;
-        }
-
-        bool localAddressMatchesWildCard = localAddressIsAny || localAddressIsSubnetAny;
-
-        if (localAddressMatchesExact && remoteAddressMatchesExact && remotePortMatchesExact)
-        { // All 4 match - this is the case of an open TCP connection, for example.
-            NS_LOG_LOGIC("Found an endpoint for case 4, adding " << endP->GetLocalAddress() << ":"
-                                                                 << endP->GetLocalPort());
-            retval4.push_back(endP);
-        }
-        if (localAddressMatchesWildCard && remoteAddressMatchesExact && remotePortMatchesExact)
-        { // All but local address - no idea what this case could be.
-            NS_LOG_LOGIC("Found an endpoint for case 3, adding " << endP->GetLocalAddress() << ":"
-                                                                 << endP->GetLocalPort());
-            retval3.push_back(endP);
-        }
-        if (localAddressMatchesExact && remoteAddressMatchesWildCard && remotePortMatchesWildCard)
-        { // Only local port and local address matches exactly - Not yet opened connection
-            NS_LOG_LOGIC("Found an endpoint for case 2, adding " << endP->GetLocalAddress() << ":"
-                                                                 << endP->GetLocalPort());
-            retval2.push_back(endP);
-        }
-        if (localAddressMatchesWildCard && remoteAddressMatchesWildCard &&
-            remotePortMatchesWildCard)
-        { // Only local port matches exactly - Endpoint open to "any" connection
-            NS_LOG_LOGIC("Found an endpoint for case 1, adding " << endP->GetLocalAddress() << ":"
-                                                                 << endP->GetLocalPort());
-            retval1.push_back(endP);
+            NS_LOG_LOGIC("Looking for SubnetDirectedAny endpoints "
+                         << addrNetpart << "/" << addr.GetMask().GetPrefixLength());
+            localWildcards.push_back(addrNetpart);
         }
     }
 
     // Here we find the most exact match
     EndPoints retval;
-    if (!retval4.empty())
-    {
-        retval = retval4;
-    }
-    else if (!retval3.empty())
+
+    // All 4 match - this is the case of an open TCP connection, for example.
+    LookupTuple({daddr, dport, saddr, sport}, incomingInterface, retval);
+
+    if (retval.empty())
     {
-        retval = retval3;
+        // All but local address - no idea what this case could be.
+        for (const auto& local : localWildcards)
+        {
+            LookupTuple({local, dport, saddr, sport}, incomingInterface, retval);
+        }
     }
-    else if (!retval2.empty())
+    if (retval.empty())
     {
-        retval = retval2;
+        // Only local port and local address matches exactly - Not yet opened connection
+        LookupTuple({daddr, dport, Ipv4Address::GetAny(), 0}, incomingInterface, retval);
     }
-    else
+    if (retval.empty())
     {
-        retval = retval1;
+        // Only local port matches exactly - Endpoint open to "any" connection
+        for (const auto& local : localWildcards)
+        {
+            LookupTuple({local, dport, Ipv4Address::GetAny(), 0}, incomingInterface, retval);
+        }
     }
 
     NS_ABORT_MSG_IF(retval.size() > 1,
@@ -361,34 +388,36 @@ Ipv4EndPointDemux::SimpleLookup(Ipv4Address daddr,
 {
     NS_LOG_FUNCTION(this << daddr << dport << saddr << sport);
 
+    auto exact = m_tupleMap.find({daddr, dport, saddr, sport});
+    if (exact != m_tupleMap.end())
+    {
+        /* this is an exact match. */
+        return exact->second.front();
+    }
+
     // this code is a copy/paste version of an old BSD ip stack lookup
     // function.
+    auto it = m_portMap.find(dport);
+    if (it == m_portMap.end())
+    {
+        return nullptr;
+    }
     uint32_t genericity = 3;
     Ipv4EndPoint* generic = nullptr;
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    for (auto endPoint : it->second)
     {
-        if ((*i)->GetLocalPort() != dport)
-        {
-            continue;
-        }
-        if ((*i)->GetLocalAddress() == daddr && (*i)->GetPeerPort() == sport &&
-            (*i)->GetPeerAddress() == saddr)
-        {
-            /* this is an exact match. */
-            return *i;
-        }
         uint32_t tmp = 0;
-        if ((*i)->GetLocalAddress() == Ipv4Address::GetAny())
+        if (endPoint->GetLocalAddress() == Ipv4Address::GetAny())
         {
             tmp++;
         }
-        if ((*i)->GetPeerAddress() == Ipv4Address::GetAny())
+        if (endPoint->GetPeerAddress() == Ipv4Address::GetAny())
         {
             tmp++;
         }
         if (tmp < genericity)
         {
-            generic = (*i);
+            generic = endPoint;
             genericity = tmp;
         }
     }
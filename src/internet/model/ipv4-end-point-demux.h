@@ -15,6 +15,7 @@
 
 #include <list>
 #include <stdint.h>
+#include <unordered_map>
 
 namespace ns3
 {
@@ -27,10 +28,17 @@ class Ipv4EndPoint;
  * @brief Demultiplexes packets to various transport layer endpoints
  *
  * This class serves as a lookup table to match partial or full information
- * about a four-tuple to an ns3::Ipv4EndPoint.  It internally contains a list
- * of endpoints, and has APIs to add and find endpoints in this demux.  This
- * code is shared in common to TCP and UDP protocols in ns3.  This demux
- * sits between ns3's layer four and the socket layer
+ * about a four-tuple to an ns3::Ipv4EndPoint.  It internally indexes the
+ * endpoints by local port and by four-tuple, and has APIs to add and find
+ * endpoints in this demux.  This code is shared in common to TCP and UDP
+ * protocols in ns3.  This demux sits between ns3's layer four and the socket
+ * layer
+ *
+ * Lookups do not scan the whole set of endpoints: the four-tuple index is
+ * probed once for each of the possible (exact or wildcard) local and remote
+ * parts of the received segment, so the cost of a lookup does not depend on
+ * the number of open connections.  Ipv4EndPoint notifies its demux when its
+ * addresses change, so that the index is kept up to date.
  */
 
 class Ipv4EndPointDemux
@@ -160,6 +168,83 @@ class Ipv4EndPointDemux
     void DeAllocate(Ipv4EndPoint* endPoint);
 
   private:
+    friend class Ipv4EndPoint;
+
+    /**
+     * @brief The four-tuple an endpoint is indexed with.
+     */
+    struct FourTuple
+    {
+        Ipv4Address localAddress; //!< Local address
+        uint16_t localPort;       //!< Local port
+        Ipv4Address peerAddress;  //!< Peer address
+        uint16_t peerPort;        //!< Peer port
+
+        /**
+         * @brief Equality operator.
+         * @param other the four-tuple to compare with
+         * @return true if the four-tuples are equal
+         */
+        bool operator==(const FourTuple& other) const;
+    };
+
+    /**
+     * @brief Hash function for FourTuple.
+     */
+    struct FourTupleHash
+    {
+        /**
+         * @brief Compute the hash of a four-tuple.
+         * @param tuple the four-tuple
+         * @return the hash
+         */
+        std::size_t operator()(const FourTuple& tuple) const;
+    };
+
+    /**
+     * @brief Add an end point to the port and four-tuple indexes.
+     * @param endPoint the end point
+     */
+    void Insert(Ipv4EndPoint* endPoint);
+
+    /**
+     * @brief Remove an end point from the port and four-tuple indexes.
+     * @param endPoint the end point
+     */
+    void Remove(Ipv4EndPoint* endPoint);
+
+    /**
+     * @brief Remove an end point from the four-tuple index only.
+     *
+     * Called by the end point before its addresses are changed.
+     *
+     * @param endPoint the end point
+     */
+    void Unindex(Ipv4EndPoint* endPoint);
+
+    /**
+     * @brief Add an end point to the four-tuple index only.
+     *
+     * Called by the end point after its addresses have been changed.
+     *
+     * @param endPoint the end point
+     */
+    void Reindex(Ipv4EndPoint* endPoint);
+
+    /**
+     * @brief Append the end points matching a four-tuple to a list.
+     *
+     * End points that can not receive packets, or that are bound to a
+     * NetDevice other than the one of the incoming interface, are skipped.
+     *
+     * @param tuple the four-tuple to look for
+     * @param incomingInterface the incoming interface
+     * @param endPoints the list to append the matching end points to
+     */
+    void LookupTuple(const FourTuple& tuple,
+                     Ptr<Ipv4Interface> incomingInterface,
+                     EndPoints& endPoints) const;
+
     /**
      * @brief Allocate an ephemeral port.
      * @returns the ephemeral port
@@ -182,9 +267,19 @@ class Ipv4EndPointDemux
     uint16_t m_portFirst;
 
     /**
-     * @brief A list of IPv4 end points.
+     * @brief The IPv4 end points, indexed by local port.
+     */
+    std::unordered_map<uint16_t, EndPoints> m_portMap;
+
+    /**
+     * @brief The IPv4 end points, indexed by four-tuple.
+     */
+    std::unordered_map<FourTuple, EndPoints, FourTupleHash> m_tupleMap;
+
+    /**
+     * @brief The number of IPv4 end points.
      */
-    EndPoints m_endPoints;
+    uint32_t m_nEndPoints{0};
 };
 
 } // namespace ns3
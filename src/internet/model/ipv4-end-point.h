@@ -23,6 +23,7 @@ namespace ns3
 
 class Header;
 class Packet;
+class Ipv4EndPointDemux;
 
 /**
  * @ingroup ipv4
@@ -180,6 +181,13 @@ class Ipv4EndPoint
     bool IsRxEnabled() const;
 
   private:
+    friend class Ipv4EndPointDemux;
+
+    /**
+     * @brief The demux this end point is indexed in (if any).
+     */
+    Ipv4EndPointDemux* m_demux;
+
     /**
      * @brief The local address.
      */
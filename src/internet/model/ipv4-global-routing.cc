@@ -7,6 +7,7 @@
 #include "ipv4-global-routing.h"
 
 #include "global-route-manager.h"
+#include "ipv4-l3-protocol.h"
 #include "ipv4-route.h"
 #include "ipv4-routing-table-entry.h"
 
@@ -72,6 +73,7 @@ Ipv4GlobalRouting::AddHostRouteTo(Ipv4Address dest, Ipv4Address nextHop, uint32_
     auto route = new Ipv4RoutingTableEntry();
     *route = Ipv4RoutingTableEntry::CreateHostRouteTo(dest, nextHop, interface);
     m_hostRoutes.push_back(route);
+    FlushForwardingCache();
 }
 
 void
@@ -81,6 +83,7 @@ Ipv4GlobalRouting::AddHostRouteTo(Ipv4Address dest, uint32_t interface)
     auto route = new Ipv4RoutingTableEntry();
     *route = Ipv4RoutingTableEntry::CreateHostRouteTo(dest, interface);
     m_hostRoutes.push_back(route);
+    FlushForwardingCache();
 }
 
 void
@@ -93,6 +96,7 @@ Ipv4GlobalRouting::AddNetworkRouteTo(Ipv4Address network,
     auto route = new Ipv4RoutingTableEntry();
     *route = Ipv4RoutingTableEntry::CreateNetworkRouteTo(network, networkMask, nextHop, interface);
     m_networkRoutes.push_back(route);
+    FlushForwardingCache();
 }
 
 void
@@ -102,6 +106,7 @@ Ipv4GlobalRouting::AddNetworkRouteTo(Ipv4Address network, Ipv4Mask networkMask,
     auto route = new Ipv4RoutingTableEntry();
     *route = Ipv4RoutingTableEntry::CreateNetworkRouteTo(network, networkMask, interface);
     m_networkRoutes.push_back(route);
+    FlushForwardingCache();
 }
 
 void
@@ -114,6 +119,7 @@ Ipv4GlobalRouting::AddASExternalRouteTo(Ipv4Address network,
     auto route = new Ipv4RoutingTableEntry();
     *route = Ipv4RoutingTableEntry::CreateNetworkRouteTo(network, networkMask, nextHop, interface);
     m_ASexternalRoutes.push_back(route);
+    FlushForwardingCache();
 }
 
 Ptr<Ipv4Route>
@@ -274,10 +280,20 @@ Ipv4GlobalRouting::GetRoute(uint32_t index) const
     return nullptr;
 }
 
+void
+Ipv4GlobalRouting::FlushForwardingCache()
+{
+    if (Ptr<Ipv4L3Protocol> ipv4 = DynamicCast<Ipv4L3Protocol>(m_ipv4))
+    {
+        ipv4->FlushForwardingCache();
+    }
+}
+
 void
 Ipv4GlobalRouting::RemoveRoute(uint32_t index)
 {
     NS_LOG_FUNCTION(this << index);
+    FlushForwardingCache();
     if (index < m_hostRoutes.size())
     {
         uint32_t tmp = 0;
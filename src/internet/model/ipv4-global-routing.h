@@ -254,6 +254,11 @@ class Ipv4GlobalRouting : public Ipv4RoutingProtocol
     /// iterator of container of Ipv4RoutingTableEntry (routes to external AS)
     typedef std::list<Ipv4RoutingTableEntry*>::iterator ASExternalRoutesI;
 
+    /**
+     * @brief Invalidate the forwarding decisions cached by the IPv4 stack after a route change.
+     */
+    void FlushForwardingCache();
+
     /**
      * @brief Lookup in the forwarding table for destination.
      * @param dest destination address
@@ -25,6 +25,7 @@
 #include "ns3/node.h"
 #include "ns3/object-vector.h"
 #include "ns3/packet.h"
+#include "ns3/segmentation-offload-tag.h"
 #include "ns3/socket.h"
 #include "ns3/string.h"
 #include "ns3/trace-source-accessor.h"
@@ -74,6 +75,16 @@ Ipv4L3Protocol::GetTypeId()
                           TimeValue(Seconds(1)),
                           MakeTimeAccessor(&Ipv4L3Protocol::m_purge),
                           MakeTimeChecker(Seconds(0)))
+            .AddAttribute("FastForwarding",
+                          "Cache the forwarding decisions of the routing protocol for transit "
+                          "packets and, while no UnicastForward or Tx trace sink and no raw "
+                          "socket is connected, forward the packets of known destinations "
+                          "without invoking the routing protocol again. Only valid with routing "
+                          "protocols whose decisions depend on the destination and input "
+                          "interface alone (static and global routing without ECMP).",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&Ipv4L3Protocol::m_fastForwarding),
+                          MakeBooleanChecker())
             .AddTraceSource("Tx",
                             "Send ipv4 packet to outgoing interface.",
                             MakeTraceSourceAccessor(&Ipv4L3Protocol::m_txTrace),
@@ -283,6 +294,7 @@ Ipv4L3Protocol::SetRoutingProtocol(Ptr<Ipv4RoutingProtocol> routingProtocol)
 {
     NS_LOG_FUNCTION(this << routingProtocol);
     m_routingProtocol = routingProtocol;
+    m_forwardingCache.clear();
     m_routingProtocol->SetIpv4(this);
 }
 
@@ -312,6 +324,7 @@ Ipv4L3Protocol::DoDispose()
     m_sockets.clear();
     m_node = nullptr;
     m_routingProtocol = nullptr;
+    m_forwardingCache.clear();
 
     for (auto it = m_fragments.begin(); it != m_fragments.end(); it++)
     {
@@ -631,6 +644,20 @@ Ipv4L3Protocol::Receive(Ptr<NetDevice> device,
         }
     }
 
+    // Transit packets of known destinations skip the routing protocol, unless something is
+    // watching the forwarding path
+    bool cacheable = m_fastForwarding && m_sockets.empty() && m_unicastForwardTrace.IsEmpty() &&
+                     m_txTrace.IsEmpty();
+    if (cacheable)
+    {
+        uint64_t key = (static_cast<uint64_t>(ipHeader.GetDestination().Get()) << 32) | interface;
+        auto it = m_forwardingCache.find(key);
+        if (it != m_forwardingCache.end() && FastForward(it->second, packet, ipHeader))
+        {
+            return;
+        }
+    }
+
     for (auto i = m_sockets.begin(); i != m_sockets.end(); ++i)
     {
         NS_LOG_LOGIC("Forwarding to raw socket");
@@ -646,7 +673,12 @@ Ipv4L3Protocol::Receive(Ptr<NetDevice> device,
     }
 
     NS_ASSERT_MSG(m_routingProtocol, "Need a routing protocol object to process packets");
-    if (!m_routingProtocol->RouteInput(packet, ipHeader, device, m_ucb, m_mcb, m_lcb, m_ecb))
+    // A decision taken synchronously by the routing protocol is recorded by IpForward
+    m_forwardingIif = cacheable ? interface : -1;
+    bool routed =
+        m_routingProtocol->RouteInput(packet, ipHeader, device, m_ucb, m_mcb, m_lcb, m_ecb);
+    m_forwardingIif = -1;
+    if (!routed)
     {
         NS_LOG_WARN("No route found for forwarding packet.  Drop.");
         m_dropTrace(ipHeader, packet, DROP_NO_ROUTE, this, interface);
@@ -978,7 +1010,16 @@ Ipv4L3Protocol::SendRealOut(Ptr<Ipv4Route> route, Ptr<Packet> packet, const Ipv4
     if (outInterface->IsUp())
     {
         NS_LOG_LOGIC("Send to " << targetLabel << " " << target);
-        if (packet->GetSize() + ipHeader.GetSerializedSize() > outInterface->GetDevice()->GetMtu())
+        // A TSO super-segment is not fragmented as long as each of its segments fits the MTU
+        // and the device is able to put the segments on the wire
+        uint32_t size = packet->GetSize();
+        SegmentationOffloadTag offloadTag;
+        if (outInterface->GetDevice()->SupportsSegmentationOffload() &&
+            packet->PeekPacketTag(offloadTag))
+        {
+            size = offloadTag.GetSegmentSize(size);
+        }
+        if (size + ipHeader.GetSerializedSize() > outInterface->GetDevice()->GetMtu())
         {
             std::list<Ipv4PayloadHeaderPair> listFragments;
             DoFragmentation(packet, ipHeader, outInterface->GetDevice()->GetMtu(), listFragments);
@@ -1044,6 +1085,13 @@ Ipv4L3Protocol::IpForward(Ptr<Ipv4Route> rtentry, Ptr<const Packet> p, const Ipv
     Ipv4Header ipHeader = header;
     Ptr<Packet> packet = p->Copy();
     int32_t interface = GetInterfaceForDevice(rtentry->GetOutputDevice());
+    if (m_forwardingIif != -1 && interface != -1)
+    {
+        uint64_t key =
+            (static_cast<uint64_t>(header.GetDestination().Get()) << 32) | m_forwardingIif;
+        m_forwardingCache[key] = {rtentry, static_cast<uint32_t>(interface)};
+        m_forwardingIif = -1;
+    }
     if (ipHeader.GetTtl() <= 1)
     {
         // Do not reply to multicast/broadcast IP address
@@ -1057,6 +1105,36 @@ Ipv4L3Protocol::IpForward(Ptr<Ipv4Route> rtentry, Ptr<const Packet> p, const Ipv
         return;
     }
     ipHeader.SetTtl(ipHeader.GetTtl() - 1);
+    SetForwardingPriority(packet, ipHeader);
+
+    m_unicastForwardTrace(ipHeader, packet, interface);
+    SendRealOut(rtentry, packet, ipHeader);
+}
+
+bool
+Ipv4L3Protocol::FastForward(const ForwardingCacheEntry& entry,
+                            Ptr<Packet> packet,
+                            Ipv4Header ipHeader)
+{
+    NS_LOG_FUNCTION(this << packet << ipHeader);
+    Ptr<Ipv4Interface> outInterface = m_interfaces[entry.interface];
+    if (ipHeader.GetTtl() <= 1 || !outInterface->IsUp() ||
+        packet->GetSize() + ipHeader.GetSerializedSize() > outInterface->GetDevice()->GetMtu())
+    {
+        return false;
+    }
+    ipHeader.SetTtl(ipHeader.GetTtl() - 1);
+    SetForwardingPriority(packet, ipHeader);
+
+    Ipv4Address gateway = entry.route->GetGateway();
+    NS_LOG_LOGIC("Fast forward to " << (gateway.IsAny() ? ipHeader.GetDestination() : gateway));
+    outInterface->Send(packet, ipHeader, gateway.IsAny() ? ipHeader.GetDestination() : gateway);
+    return true;
+}
+
+void
+Ipv4L3Protocol::SetForwardingPriority(Ptr<Packet> packet, const Ipv4Header& ipHeader) const
+{
     // in case the packet still has a priority tag attached, remove it
     SocketPriorityTag priorityTag;
     packet->RemovePacketTag(priorityTag);
@@ -1067,9 +1145,13 @@ Ipv4L3Protocol::IpForward(Ptr<Ipv4Route> rtentry, Ptr<const Packet> p, const Ipv
         priorityTag.SetPriority(priority);
         packet->AddPacketTag(priorityTag);
     }
+}
 
-    m_unicastForwardTrace(ipHeader, packet, interface);
-    SendRealOut(rtentry, packet, ipHeader);
+void
+Ipv4L3Protocol::FlushForwardingCache()
+{
+    NS_LOG_FUNCTION(this);
+    m_forwardingCache.clear();
 }
 
 void
@@ -1141,6 +1223,7 @@ Ipv4L3Protocol::AddAddress(uint32_t i, Ipv4InterfaceAddress address)
     NS_LOG_FUNCTION(this << i << address);
     Ptr<Ipv4Interface> interface = GetInterface(i);
     bool retVal = interface->AddAddress(address);
+    m_forwardingCache.clear();
     if (m_routingProtocol)
     {
         m_routingProtocol->NotifyAddAddress(i, address);
@@ -1170,6 +1253,7 @@ Ipv4L3Protocol::RemoveAddress(uint32_t i, uint32_t addressIndex)
     Ipv4InterfaceAddress address = interface->RemoveAddress(addressIndex);
     if (address != Ipv4InterfaceAddress())
     {
+        m_forwardingCache.clear();
         if (m_routingProtocol)
         {
             m_routingProtocol->NotifyRemoveAddress(i, address);
@@ -1193,6 +1277,7 @@ Ipv4L3Protocol::RemoveAddress(uint32_t i, Ipv4Address address)
     Ipv4InterfaceAddress ifAddr = interface->RemoveAddress(address);
     if (ifAddr != Ipv4InterfaceAddress())
     {
+        m_forwardingCache.clear();
         if (m_routingProtocol)
         {
             m_routingProtocol->NotifyRemoveAddress(i, ifAddr);
@@ -1297,6 +1382,7 @@ Ipv4L3Protocol::SetMetric(uint32_t i, uint16_t metric)
     NS_LOG_FUNCTION(this << i << metric);
     Ptr<Ipv4Interface> interface = GetInterface(i);
     interface->SetMetric(metric);
+    m_forwardingCache.clear();
 }
 
 uint16_t
@@ -1333,6 +1419,7 @@ Ipv4L3Protocol::SetUp(uint32_t i)
     if (interface->GetDevice()->GetMtu() >= 68)
     {
         interface->SetUp();
+        m_forwardingCache.clear();
 
         if (m_routingProtocol)
         {
@@ -1354,6 +1441,7 @@ Ipv4L3Protocol::SetDown(uint32_t ifaceIndex)
     NS_LOG_FUNCTION(this << ifaceIndex);
     Ptr<Ipv4Interface> interface = GetInterface(ifaceIndex);
     interface->SetDown();
+    m_forwardingCache.clear();
 
     if (m_routingProtocol)
     {
@@ -1375,6 +1463,7 @@ Ipv4L3Protocol::SetForwarding(uint32_t i, bool val)
     NS_LOG_FUNCTION(this << i);
     Ptr<Ipv4Interface> interface = GetInterface(i);
     interface->SetForwarding(val);
+    m_forwardingCache.clear();
 }
 
 Ptr<NetDevice>
@@ -1388,6 +1477,7 @@ Ipv4L3Protocol::SetIpForward(bool forward)
 {
     NS_LOG_FUNCTION(this << forward);
     m_ipForward = forward;
+    m_forwardingCache.clear();
     for (auto i = m_interfaces.begin(); i != m_interfaces.end(); i++)
     {
         (*i)->SetForwarding(forward);
@@ -1405,6 +1495,7 @@ Ipv4L3Protocol::SetWeakEsModel(bool model)
 {
     NS_LOG_FUNCTION(this << model);
     m_strongEndSystemModel = !model;
+    m_forwardingCache.clear();
 }
 
 bool
@@ -1418,6 +1509,7 @@ Ipv4L3Protocol::SetStrongEndSystemModel(bool model)
 {
     NS_LOG_FUNCTION(this << model);
     m_strongEndSystemModel = model;
+    m_forwardingCache.clear();
 }
 
 bool
@@ -1454,6 +1546,10 @@ Ipv4L3Protocol::DoFragmentation(Ptr<Packet> packet,
 
     Ptr<Packet> p = packet->Copy();
 
+    // Fragments are not TSO super-segments: do not let them inherit the tag
+    SegmentationOffloadTag offloadTag;
+    p->RemovePacketTag(offloadTag);
+
     NS_ASSERT_MSG((ipv4Header.GetSerializedSize() == 5 * 4),
                   "IPv4 fragmentation implementation only works without option headers.");
 
@@ -24,6 +24,7 @@
 #include <list>
 #include <map>
 #include <stdint.h>
+#include <unordered_map>
 #include <vector>
 
 class Ipv4L3ProtocolTestCase;
@@ -135,6 +136,15 @@ class Ipv4L3Protocol : public Ipv4
      */
     void SetDefaultTtl(uint8_t ttl);
 
+    /**
+     * @brief Forget the forwarding decisions cached by the FastForwarding mode.
+     *
+     * The cache is flushed automatically when an interface, an address or the routing
+     * protocol changes, and when the static or global routing tables change. Routing protocols
+     * that change their routes in other ways must call this method.
+     */
+    void FlushForwardingCache();
+
     /**
      * Lower layer calls this method after calling L3Demux::Lookup
      * The ARP subclass needs to know from which NetDevice this
@@ -342,6 +352,13 @@ class Ipv4L3Protocol : public Ipv4
      */
     void IpForward(Ptr<Ipv4Route> rtentry, Ptr<const Packet> p, const Ipv4Header& header);
 
+    /**
+     * @brief Sets the priority tag of a packet being forwarded from its ToS field.
+     * @param packet the packet
+     * @param ipHeader the IPv4 header of the packet
+     */
+    void SetForwardingPriority(Ptr<Packet> packet, const Ipv4Header& ipHeader) const;
+
     /**
      * @brief Forward a multicast packet.
      * @param mrtentry route
@@ -636,6 +653,34 @@ class Ipv4L3Protocol : public Ipv4
     Time m_purge;       //!< time between purging expired duplicate entries
     EventId m_cleanDpd; //!< event to cleanup expired duplicate entries
 
+    /// A forwarding decision of the routing protocol
+    struct ForwardingCacheEntry
+    {
+        Ptr<Ipv4Route> route; //!< The route the packets are forwarded on
+        uint32_t interface;   //!< The output interface index
+    };
+
+    /// Forwarding decisions, by destination address (high 32 bits) and input interface index
+    typedef std::unordered_map<uint64_t, ForwardingCacheEntry> ForwardingCache_t;
+
+    /**
+     * @brief Forward a transit packet along a cached forwarding decision.
+     *
+     * The routing protocol, the forwarding traces and the route checks are skipped. Packets
+     * whose TTL expires, that need fragmentation or whose output interface is down are left to
+     * the regular forwarding path, which reports them.
+     *
+     * @param entry the cached forwarding decision
+     * @param packet the packet, without its IPv4 header
+     * @param ipHeader the IPv4 header of the packet
+     * @return true if the packet has been forwarded
+     */
+    bool FastForward(const ForwardingCacheEntry& entry, Ptr<Packet> packet, Ipv4Header ipHeader);
+
+    bool m_fastForwarding;               //!< Cache the forwarding decisions of transit packets
+    ForwardingCache_t m_forwardingCache; //!< Cached forwarding decisions
+    int32_t m_forwardingIif{-1}; //!< Input interface of the packet being routed, if cacheable
+
     Ipv4RoutingProtocol::UnicastForwardCallback m_ucb;   ///< Unicast forward callback
     Ipv4RoutingProtocol::MulticastForwardCallback m_mcb; ///< Multicast forward callback
     Ipv4RoutingProtocol::LocalDeliverCallback m_lcb;     ///< Local delivery callback
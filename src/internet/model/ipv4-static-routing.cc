@@ -15,6 +15,7 @@
 
 #include "ipv4-static-routing.h"
 
+#include "ipv4-l3-protocol.h"
 #include "ipv4-route.h"
 #include "ipv4-routing-table-entry.h"
 
@@ -69,6 +70,7 @@ Ipv4StaticRouting::AddNetworkRouteTo(Ipv4Address network,
     {
         auto routePtr = new Ipv4RoutingTableEntry(route);
         m_networkRoutes.emplace_back(routePtr, metric);
+        FlushForwardingCache();
     }
 }
 
@@ -87,6 +89,7 @@ Ipv4StaticRouting::AddNetworkRouteTo(Ipv4Address network,
         auto routePtr = new Ipv4RoutingTableEntry(route);
 
         m_networkRoutes.emplace_back(routePtr, metric);
+        FlushForwardingCache();
     }
 }
 
@@ -437,6 +440,15 @@ Ipv4StaticRouting::GetMetric(uint32_t index) const
     return 0;
 }
 
+void
+Ipv4StaticRouting::FlushForwardingCache()
+{
+    if (Ptr<Ipv4L3Protocol> ipv4 = DynamicCast<Ipv4L3Protocol>(m_ipv4))
+    {
+        ipv4->FlushForwardingCache();
+    }
+}
+
 void
 Ipv4StaticRouting::RemoveRoute(uint32_t index)
 {
@@ -448,6 +460,7 @@ Ipv4StaticRouting::RemoveRoute(uint32_t index)
         {
             delete j->first;
             m_networkRoutes.erase(j);
+            FlushForwardingCache();
             return;
         }
         tmp++;
@@ -370,6 +370,11 @@ class Ipv4StaticRouting : public Ipv4RoutingProtocol
     /// Iterator for container for the multicast routes
     typedef std::list<Ipv4MulticastRoutingTableEntry*>::iterator MulticastRoutesI;
 
+    /**
+     * @brief Invalidate the forwarding decisions cached by the IPv4 stack after a route change.
+     */
+    void FlushForwardingCache();
+
     /**
      * @brief Checks if a route is already present in the forwarding table.
      * @param route route
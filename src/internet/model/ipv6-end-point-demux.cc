@@ -28,36 +28,150 @@ Ipv6EndPointDemux::Ipv6EndPointDemux()
 Ipv6EndPointDemux::~Ipv6EndPointDemux()
 {
     NS_LOG_FUNCTION(this);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    for (auto& [port, endPoints] : m_portMap)
     {
-        Ipv6EndPoint* endPoint = *i;
-        delete endPoint;
+        for (auto endPoint : endPoints)
+        {
+            endPoint->m_demux = nullptr;
+            delete endPoint;
+        }
     }
-    m_endPoints.clear();
+    m_portMap.clear();
+    m_tupleMap.clear();
 }
 
 bool
-Ipv6EndPointDemux::LookupPortLocal(uint16_t port)
+Ipv6EndPointDemux::FourTuple::operator==(const FourTuple& other) const
 {
-    NS_LOG_FUNCTION(this << port);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    return localPort == other.localPort && peerPort == other.peerPort &&
+           localAddress == other.localAddress && peerAddress == other.peerAddress;
+}
+
+std::size_t
+Ipv6EndPointDemux::FourTupleHash::operator()(const FourTuple& tuple) const
+{
+    Ipv6AddressHash addressHash;
+    uint32_t ports = (static_cast<uint32_t>(tuple.localPort) << 16) | tuple.peerPort;
+    std::size_t h = addressHash(tuple.localAddress);
+    h ^= addressHash(tuple.peerAddress) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    return h ^ (std::hash<uint32_t>()(ports) + 0x9e3779b9 + (h << 6) + (h >> 2));
+}
+
+void
+Ipv6EndPointDemux::Insert(Ipv6EndPoint* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+    endPoint->m_demux = this;
+    m_portMap[endPoint->GetLocalPort()].push_back(endPoint);
+    m_nEndPoints++;
+    Reindex(endPoint);
+}
+
+void
+Ipv6EndPointDemux::Remove(Ipv6EndPoint* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+    Unindex(endPoint);
+    auto it = m_portMap.find(endPoint->GetLocalPort());
+    if (it == m_portMap.end())
+    {
+        return;
+    }
+    it->second.remove(endPoint);
+    if (it->second.empty())
+    {
+        m_portMap.erase(it);
+    }
+    m_nEndPoints--;
+    endPoint->m_demux = nullptr;
+}
+
+void
+Ipv6EndPointDemux::Unindex(Ipv6EndPoint* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+    auto it = m_tupleMap.find({endPoint->GetLocalAddress(),
+                               endPoint->GetLocalPort(),
+                               endPoint->GetPeerAddress(),
+                               endPoint->GetPeerPort()});
+    if (it == m_tupleMap.end())
+    {
+        return;
+    }
+    it->second.remove(endPoint);
+    if (it->second.empty())
+    {
+        m_tupleMap.erase(it);
+    }
+}
+
+void
+Ipv6EndPointDemux::Reindex(Ipv6EndPoint* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+    m_tupleMap[{endPoint->GetLocalAddress(),
+                endPoint->GetLocalPort(),
+                endPoint->GetPeerAddress(),
+                endPoint->GetPeerPort()}]
+        .push_back(endPoint);
+}
+
+void
+Ipv6EndPointDemux::LookupTuple(const FourTuple& tuple,
+                               Ptr<Ipv6Interface> incomingInterface,
+                               EndPoints& endPoints) const
+{
+    auto it = m_tupleMap.find(tuple);
+    if (it == m_tupleMap.end())
     {
-        if ((*i)->GetLocalPort() == port)
+        return;
+    }
+    for (auto endP : it->second)
+    {
+        NS_LOG_DEBUG("Looking at endpoint dport="
+                     << endP->GetLocalPort() << " daddr=" << endP->GetLocalAddress()
+                     << " sport=" << endP->GetPeerPort() << " saddr=" << endP->GetPeerAddress());
+
+        if (!endP->IsRxEnabled())
         {
-            return true;
+            NS_LOG_LOGIC("Skipping endpoint " << &endP
+                                              << " because endpoint can not receive packets");
+            continue;
+        }
+        if (endP->GetBoundNetDevice())
+        {
+            if (!incomingInterface || endP->GetBoundNetDevice() != incomingInterface->GetDevice())
+            {
+                NS_LOG_LOGIC("Skipping endpoint "
+                             << &endP << " because endpoint is bound to specific device and"
+                             << endP->GetBoundNetDevice() << " does not match packet device");
+                continue;
+            }
         }
+        endPoints.push_back(endP);
     }
-    return false;
+}
+
+bool
+Ipv6EndPointDemux::LookupPortLocal(uint16_t port)
+{
+    NS_LOG_FUNCTION(this << port);
+    return m_portMap.find(port) != m_portMap.end();
 }
 
 bool
 Ipv6EndPointDemux::LookupLocal(Ptr<NetDevice> boundNetDevice, Ipv6Address addr, uint16_t port)
 {
     NS_LOG_FUNCTION(this << addr << port);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    auto it = m_portMap.find(port);
+    if (it == m_portMap.end())
+    {
+        return false;
+    }
+    for (auto endPoint : it->second)
     {
-        if ((*i)->GetLocalPort() == port && (*i)->GetLocalAddress() == addr &&
-            (*i)->GetBoundNetDevice() == boundNetDevice)
+        if (endPoint->GetLocalAddress() == addr &&
+            endPoint->GetBoundNetDevice() == boundNetDevice)
         {
             return true;
         }
@@ -76,8 +190,8 @@ Ipv6EndPointDemux::Allocate()
         return nullptr;
     }
     auto endPoint = new Ipv6EndPoint(Ipv6Address::GetAny(), port);
-    m_endPoints.push_back(endPoint);
-    NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
+    Insert(endPoint);
+    NS_LOG_DEBUG("Now have >>" << m_nEndPoints << "<< endpoints.");
     return endPoint;
 }
 
@@ -92,8 +206,8 @@ Ipv6EndPointDemux::Allocate(Ipv6Address address)
         return nullptr;
     }
     auto endPoint = new Ipv6EndPoint(address, port);
-    m_endPoints.push_back(endPoint);
-    NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
+    Insert(endPoint);
+    NS_LOG_DEBUG("Now have >>" << m_nEndPoints << "<< endpoints.");
     return endPoint;
 }
 
@@ -115,8 +229,8 @@ Ipv6EndPointDemux::Allocate(Ptr<NetDevice> boundNetDevice, Ipv6Address address,
         return nullptr;
     }
     auto endPoint = new Ipv6EndPoint(address, port);
-    m_endPoints.push_back(endPoint);
-    NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
+    Insert(endPoint);
+    NS_LOG_DEBUG("Now have >>" << m_nEndPoints << "<< endpoints.");
     return endPoint;
 }
 
@@ -128,21 +242,24 @@ Ipv6EndPointDemux::Allocate(Ptr<NetDevice> boundNetDevice,
                             uint16_t peerPort)
 {
     NS_LOG_FUNCTION(this << boundNetDevice << localAddress << localPort << peerAddress << peerPort);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    auto it = m_tupleMap.find({localAddress, localPort, peerAddress, peerPort});
+    if (it != m_tupleMap.end())
     {
-        if ((*i)->GetLocalPort() == localPort && (*i)->GetLocalAddress() == localAddress &&
-            (*i)->GetPeerPort() == peerPort && (*i)->GetPeerAddress() == peerAddress &&
-            ((*i)->GetBoundNetDevice() == boundNetDevice || !(*i)->GetBoundNetDevice()))
+        for (auto endPoint : it->second)
         {
-            NS_LOG_WARN("Duplicated endpoint.");
-            return nullptr;
+            if (endPoint->GetBoundNetDevice() == boundNetDevice ||
+                !endPoint->GetBoundNetDevice())
+            {
+                NS_LOG_WARN("Duplicated endpoint.");
+                return nullptr;
+            }
         }
     }
     auto endPoint = new Ipv6EndPoint(localAddress, localPort);
     endPoint->SetPeer(peerAddress, peerPort);
-    m_endPoints.push_back(endPoint);
+    Insert(endPoint);
 
-    NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
+    NS_LOG_DEBUG("Now have >>" << m_nEndPoints << "<< endpoints.");
 
     return endPoint;
 }
@@ -150,16 +267,13 @@ Ipv6EndPointDemux::Allocate(Ptr<NetDevice> boundNetDevice,
 void
 Ipv6EndPointDemux::DeAllocate(Ipv6EndPoint* endPoint)
 {
-    NS_LOG_FUNCTION(this);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    NS_LOG_FUNCTION(this << endPoint);
+    if (endPoint->m_demux != this)
     {
-        if (*i == endPoint)
-        {
-            delete endPoint;
-            m_endPoints.erase(i);
-            break;
-        }
+        return;
     }
+    Remove(endPoint);
+    delete endPoint;
 }
 
 /*
@@ -176,118 +290,35 @@ Ipv6EndPointDemux::Lookup(Ipv6Address daddr,
 {
     NS_LOG_FUNCTION(this << daddr << dport << saddr << sport << incomingInterface);
 
-    EndPoints retval1; /* Matches exact on local port, wildcards on others */
-    EndPoints retval2; /* Matches exact on local port/adder, wildcards on others */
-    EndPoints retval3; /* Matches all but local address */
-    EndPoints retval4; /* Exact match on all 4 */
-
     NS_LOG_DEBUG("Looking up endpoint for destination address " << daddr);
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    if (m_portMap.find(dport) == m_portMap.end())
     {
-        Ipv6EndPoint* endP = *i;
-
-        NS_LOG_DEBUG("Looking at endpoint dport="
-                     << endP->GetLocalPort() << " daddr=" << endP->GetLocalAddress()
-                     << " sport=" << endP->GetPeerPort() << " saddr=" << endP->GetPeerAddress());
-
-        if (!endP->IsRxEnabled())
-        {
-            NS_LOG_LOGIC("Skipping endpoint " << &endP
-                                              << " because endpoint can not receive packets");
-            continue;
-        }
-
-        if (endP->GetLocalPort() != dport)
-        {
-            NS_LOG_LOGIC("Skipping endpoint " << &endP << " because endpoint dport "
-                                              << endP->GetLocalPort()
-                                              << " does not match packet dport " << dport);
-            continue;
-        }
-
-        if (endP->GetBoundNetDevice())
-        {
-            if (!incomingInterface)
-            {
-                continue;
-            }
-            if (endP->GetBoundNetDevice() != incomingInterface->GetDevice())
-            {
-                NS_LOG_LOGIC("Skipping endpoint "
-                             << &endP << " because endpoint is bound to specific device and"
-                             << endP->GetBoundNetDevice() << " does not match packet device "
-                             << incomingInterface->GetDevice());
-                continue;
-            }
-        }
-
-        /*    Ipv6Address incomingInterfaceAddr = incomingInterface->GetAddress (); */
-        NS_LOG_DEBUG("dest addr " << daddr);
-
-        bool localAddressMatchesWildCard = endP->GetLocalAddress() == Ipv6Address::GetAny();
-        bool localAddressMatchesExact = endP->GetLocalAddress() == daddr;
-        bool localAddressMatchesAllRouters =
-            endP->GetLocalAddress() == Ipv6Address::GetAllRoutersMulticast();
-
-        /* if no match here, keep looking */
-        if (!(localAddressMatchesExact || localAddressMatchesWildCard))
-        {
-            continue;
-        }
-        bool remotePeerMatchesExact = endP->GetPeerPort() == sport;
-        bool remotePeerMatchesWildCard = endP->GetPeerPort() == 0;
-        bool remoteAddressMatchesExact = endP->GetPeerAddress() == saddr;
-        bool remoteAddressMatchesWildCard = endP->GetPeerAddress() == Ipv6Address::GetAny();
-
-        /* If remote does not match either with exact or wildcard,i
-           skip this one */
-        if (!(remotePeerMatchesExact || remotePeerMatchesWildCard))
-        {
-            continue;
-        }
-        if (!(remoteAddressMatchesExact || remoteAddressMatchesWildCard))
-        {
-            continue;
-        }
-
-        /* Now figure out which return list to add this one to */
-        if (localAddressMatchesWildCard && remotePeerMatchesWildCard &&
-            remoteAddressMatchesWildCard)
-        { /* Only local port matches exactly */
-            retval1.push_back(endP);
-        }
-        if ((localAddressMatchesExact || (localAddressMatchesAllRouters)) &&
-            remotePeerMatchesWildCard && remoteAddressMatchesWildCard)
-        { /* Only local port and local address matches exactly */
-            retval2.push_back(endP);
-        }
-        if (localAddressMatchesWildCard && remotePeerMatchesExact && remoteAddressMatchesExact)
-        { /* All but local address */
-            retval3.push_back(endP);
-        }
-        if (localAddressMatchesExact && remotePeerMatchesExact && remoteAddressMatchesExact)
-        { /* All 4 match */
-            retval4.push_back(endP);
-        }
+        NS_LOG_LOGIC("No endpoint bound to port " << dport);
+        return EndPoints();
     }
 
-    // Here we find the most exact match
+    /* Here we find the most exact match */
     EndPoints retval;
-    if (!retval4.empty())
-    {
-        retval = retval4;
-    }
-    else if (!retval3.empty())
+
+    /* All 4 match */
+    LookupTuple({daddr, dport, saddr, sport}, incomingInterface, retval);
+
+    if (retval.empty() && daddr != Ipv6Address::GetAny())
     {
-        retval = retval3;
+        /* All but local address */
+        LookupTuple({Ipv6Address::GetAny(), dport, saddr, sport}, incomingInterface, retval);
     }
-    else if (!retval2.empty())
+    if (retval.empty())
     {
-        retval = retval2;
+        /* Only local port and local address matches exactly */
+        LookupTuple({daddr, dport, Ipv6Address::GetAny(), 0}, incomingInterface, retval);
     }
-    else
+    if (retval.empty() && daddr != Ipv6Address::GetAny())
     {
-        retval = retval1;
+        /* Only local port matches exactly */
+        LookupTuple({Ipv6Address::GetAny(), dport, Ipv6Address::GetAny(), 0},
+                    incomingInterface,
+                    retval);
     }
 
     NS_ABORT_MSG_IF(retval.size() > 1,
@@ -299,38 +330,39 @@ Ipv6EndPointDemux::Lookup(Ipv6Address daddr,
 Ipv6EndPoint*
 Ipv6EndPointDemux::SimpleLookup(Ipv6Address dst, uint16_t dport, Ipv6Address src, uint16_t sport)
 {
+    auto exact = m_tupleMap.find({dst, dport, src, sport});
+    if (exact != m_tupleMap.end())
+    {
+        /* this is an exact match. */
+        return exact->second.front();
+    }
+
+    auto it = m_portMap.find(dport);
+    if (it == m_portMap.end())
+    {
+        return nullptr;
+    }
+
     uint32_t genericity = 3;
     Ipv6EndPoint* generic = nullptr;
 
-    for (auto i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    for (auto endPoint : it->second)
     {
         uint32_t tmp = 0;
 
-        if ((*i)->GetLocalPort() != dport)
-        {
-            continue;
-        }
-
-        if ((*i)->GetLocalAddress() == dst && (*i)->GetPeerPort() == sport &&
-            (*i)->GetPeerAddress() == src)
-        {
-            /* this is an exact match. */
-            return *i;
-        }
-
-        if ((*i)->GetLocalAddress() == Ipv6Address::GetAny())
+        if (endPoint->GetLocalAddress() == Ipv6Address::GetAny())
         {
             tmp++;
         }
 
-        if ((*i)->GetPeerAddress() == Ipv6Address::GetAny())
+        if (endPoint->GetPeerAddress() == Ipv6Address::GetAny())
         {
             tmp++;
         }
 
         if (tmp < genericity)
         {
-            generic = (*i);
+            generic = endPoint;
             genericity = tmp;
         }
     }
@@ -362,7 +394,12 @@ Ipv6EndPointDemux::AllocateEphemeralPort()
 Ipv6EndPointDemux::EndPoints
 Ipv6EndPointDemux::GetEndPoints() const
 {
-    return m_endPoints;
+    EndPoints ret;
+    for (const auto& [port, endPoints] : m_portMap)
+    {
+        ret.insert(ret.end(), endPoints.begin(), endPoints.end());
+    }
+    return ret;
 }
 
 } /* namespace ns3 */
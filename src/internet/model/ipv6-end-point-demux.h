@@ -15,6 +15,7 @@
 
 #include <list>
 #include <stdint.h>
+#include <unordered_map>
 
 namespace ns3
 {
@@ -25,6 +26,9 @@ class Ipv6EndPoint;
  * @ingroup ipv6
  *
  * @brief Demultiplexer for end points.
+ *
+ * The end points are indexed by local port and by four-tuple, so that a
+ * lookup costs a few hash probes regardless of the number of end points.
  */
 class Ipv6EndPointDemux
 {
@@ -150,6 +154,83 @@ class Ipv6EndPointDemux
     EndPoints GetEndPoints() const;
 
   private:
+    friend class Ipv6EndPoint;
+
+    /**
+     * @brief The four-tuple an endpoint is indexed with.
+     */
+    struct FourTuple
+    {
+        Ipv6Address localAddress; //!< Local address
+        uint16_t localPort;       //!< Local port
+        Ipv6Address peerAddress;  //!< Peer address
+        uint16_t peerPort;        //!< Peer port
+
+        /**
+         * @brief Equality operator.
+         * @param other the four-tuple to compare with
+         * @return true if the four-tuples are equal
+         */
+        bool operator==(const FourTuple& other) const;
+    };
+
+    /**
+     * @brief Hash function for FourTuple.
+     */
+    struct FourTupleHash
+    {
+        /**
+         * @brief Compute the hash of a four-tuple.
+         * @param tuple the four-tuple
+         * @return the hash
+         */
+        std::size_t operator()(const FourTuple& tuple) const;
+    };
+
+    /**
+     * @brief Add an end point to the port and four-tuple indexes.
+     * @param endPoint the end point
+     */
+    void Insert(Ipv6EndPoint* endPoint);
+
+    /**
+     * @brief Remove an end point from the port and four-tuple indexes.
+     * @param endPoint the end point
+     */
+    void Remove(Ipv6EndPoint* endPoint);
+
+    /**
+     * @brief Remove an end point from the four-tuple index only.
+     *
+     * Called by the end point before its addresses are changed.
+     *
+     * @param endPoint the end point
+     */
+    void Unindex(Ipv6EndPoint* endPoint);
+
+    /**
+     * @brief Add an end point to the four-tuple index only.
+     *
+     * Called by the end point after its addresses have been changed.
+     *
+     * @param endPoint the end point
+     */
+    void Reindex(Ipv6EndPoint* endPoint);
+
+    /**
+     * @brief Append the end points matching a four-tuple to a list.
+     *
+     * End points that can not receive packets, or that are bound to a
+     * NetDevice other than the one of the incoming interface, are skipped.
+     *
+     * @param tuple the four-tuple to look for
+     * @param incomingInterface the incoming interface
+     * @param endPoints the list to append the matching end points to
+     */
+    void LookupTuple(const FourTuple& tuple,
+                     Ptr<Ipv6Interface> incomingInterface,
+                     EndPoints& endPoints) const;
+
     /**
      * @brief Allocate a ephemeral port.
      * @return a port
@@ -172,9 +253,19 @@ class Ipv6EndPointDemux
     uint16_t m_portLast;
 
     /**
-     * @brief A list of IPv6 end points.
+     * @brief The IPv6 end points, indexed by local port.
+     */
+    std::unordered_map<uint16_t, EndPoints> m_portMap;
+
+    /**
+     * @brief The IPv6 end points, indexed by four-tuple.
+     */
+    std::unordered_map<FourTuple, EndPoints, FourTupleHash> m_tupleMap;
+
+    /**
+     * @brief The number of IPv6 end points.
      */
-    EndPoints m_endPoints;
+    uint32_t m_nEndPoints{0};
 };
 
 } /* namespace ns3 */
@@ -8,6 +8,8 @@
 
 #include "ipv6-end-point.h"
 
+#include "ipv6-end-point-demux.h"
+
 #include "ns3/log.h"
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
@@ -18,7 +20,8 @@ namespace ns3
 NS_LOG_COMPONENT_DEFINE("Ipv6EndPoint");
 
 Ipv6EndPoint::Ipv6EndPoint(Ipv6Address addr, uint16_t port)
-    : m_localAddr(addr),
+    : m_demux(nullptr),
+      m_localAddr(addr),
       m_localPort(port),
       m_peerAddr(Ipv6Address::GetAny()),
       m_peerPort(0),
@@ -46,7 +49,15 @@ Ipv6EndPoint::GetLocalAddress() const
 void
 Ipv6EndPoint::SetLocalAddress(Ipv6Address addr)
 {
+    if (m_demux)
+    {
+        m_demux->Unindex(this);
+    }
     m_localAddr = addr;
+    if (m_demux)
+    {
+        m_demux->Reindex(this);
+    }
 }
 
 uint16_t
@@ -58,7 +69,16 @@ Ipv6EndPoint::GetLocalPort() const
 void
 Ipv6EndPoint::SetLocalPort(uint16_t port)
 {
+    Ipv6EndPointDemux* demux = m_demux;
+    if (demux)
+    {
+        demux->Remove(this);
+    }
     m_localPort = port;
+    if (demux)
+    {
+        demux->Insert(this);
+    }
 }
 
 Ipv6Address
@@ -88,8 +108,16 @@ Ipv6EndPoint::GetBoundNetDevice() const
 void
 Ipv6EndPoint::SetPeer(Ipv6Address addr, uint16_t port)
 {
+    if (m_demux)
+    {
+        m_demux->Unindex(this);
+    }
     m_peerAddr = addr;
     m_peerPort = port;
+    if (m_demux)
+    {
+        m_demux->Reindex(this);
+    }
 }
 
 void
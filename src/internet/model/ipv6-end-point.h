@@ -23,6 +23,7 @@ namespace ns3
 
 class Header;
 class Packet;
+class Ipv6EndPointDemux;
 
 /**
  * @ingroup ipv6
@@ -184,6 +185,13 @@ class Ipv6EndPoint
     bool IsRxEnabled() const;
 
   private:
+    friend class Ipv6EndPointDemux;
+
+    /**
+     * @brief The demux this end point is indexed in (if any).
+     */
+    Ipv6EndPointDemux* m_demux;
+
     /**
      * @brief The local address.
      */
@@ -21,6 +21,7 @@
 #include "ns3/ipv6-address.h"
 #include "ns3/log.h"
 #include "ns3/object-vector.h"
+#include "ns3/segmentation-offload-tag.h"
 #include "ns3/trace-source-accessor.h"
 #include "ns3/uinteger.h"
 
@@ -450,6 +451,10 @@ Ipv6ExtensionFragment::GetFragments(Ptr<Packet> packet,
     NS_LOG_FUNCTION(this << packet << ipv6Header << maxFragmentSize);
     Ptr<Packet> p = packet->Copy();
 
+    // Fragments are not TSO super-segments: do not let them inherit the tag
+    SegmentationOffloadTag offloadTag;
+    p->RemovePacketTag(offloadTag);
+
     uint8_t nextHeader = ipv6Header.GetNextHeader();
     uint8_t ipv6HeaderSize = ipv6Header.GetSerializedSize();
 
@@ -29,6 +29,7 @@
 #include "ns3/mac64-address.h"
 #include "ns3/node.h"
 #include "ns3/object-vector.h"
+#include "ns3/segmentation-offload-tag.h"
 #include "ns3/trace-source-accessor.h"
 #include "ns3/traffic-control-layer.h"
 #include "ns3/uinteger.h"
@@ -1217,7 +1218,15 @@ Ipv6L3Protocol::SendRealOut(Ptr<Ipv6Route> route, Ptr<Packet> packet, const Ipv6
         targetMtu = dev->GetMtu();
     }
 
-    if (packet->GetSize() + ipHeader.GetSerializedSize() > targetMtu)
+    // A TSO super-segment is not fragmented as long as each of its segments fits the MTU
+    // and the device is able to put the segments on the wire
+    uint32_t size = packet->GetSize();
+    SegmentationOffloadTag offloadTag;
+    if (dev->SupportsSegmentationOffload() && packet->PeekPacketTag(offloadTag))
+    {
+        size = offloadTag.GetSegmentSize(size);
+    }
+    if (size + ipHeader.GetSerializedSize() > targetMtu)
     {
         // Router => drop
         if (!fromMe)
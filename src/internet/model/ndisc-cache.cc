@@ -17,6 +17,8 @@
 #include "ns3/node.h"
 #include "ns3/uinteger.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -90,9 +92,10 @@ NdiscCache::Lookup(Ipv6Address dst)
 {
     NS_LOG_FUNCTION(this << dst);
 
-    if (m_ndCache.find(dst) != m_ndCache.end())
+    auto it = m_ndCache.find(dst);
+    if (it != m_ndCache.end())
     {
-        NdiscCache::Entry* entry = m_ndCache[dst];
+        NdiscCache::Entry* entry = it->second;
         NS_LOG_LOGIC("Found an entry: " << *entry);
 
         return entry;
@@ -107,9 +110,8 @@ NdiscCache::LookupInverse(Address dst)
     NS_LOG_FUNCTION(this << dst);
 
     std::list<NdiscCache::Entry*> entryList;
-    for (auto i = m_ndCache.begin(); i != m_ndCache.end(); i++)
+    for (const auto& [address, entry] : m_ndCache)
     {
-        NdiscCache::Entry* entry = (*i).second;
         if (entry->GetMacAddress() == dst)
         {
             NS_LOG_LOGIC("Found an entry:" << (*entry));
@@ -136,15 +138,12 @@ NdiscCache::Remove(NdiscCache::Entry* entry)
 {
     NS_LOG_FUNCTION(this << entry);
 
-    for (auto i = m_ndCache.begin(); i != m_ndCache.end(); i++)
+    auto it = m_ndCache.find(entry->GetIpv6Address());
+    if (it != m_ndCache.end() && it->second == entry)
     {
-        if ((*i).second == entry)
-        {
-            m_ndCache.erase(i);
-            entry->ClearWaitingPacket();
-            delete entry;
-            return;
-        }
+        m_ndCache.erase(it);
+        entry->ClearWaitingPacket();
+        delete entry;
     }
 }
 
@@ -181,9 +180,9 @@ NdiscCache::PrintNdiscCache(Ptr<OutputStreamWrapper> stream)
     NS_LOG_FUNCTION(this << stream);
     std::ostream* os = stream->GetStream();
 
-    for (auto i = m_ndCache.begin(); i != m_ndCache.end(); i++)
+    for (NdiscCache::Entry* entry : GetSortedEntries())
     {
-        *os << i->first << " dev ";
+        *os << entry->GetIpv6Address() << " dev ";
         std::string found = Names::FindName(m_device);
         if (!Names::FindName(m_device).empty())
         {
@@ -194,33 +193,33 @@ NdiscCache::PrintNdiscCache(Ptr<OutputStreamWrapper> stream)
             *os << static_cast<int>(m_device->GetIfIndex());
         }
 
-        *os << " lladdr " << i->second->GetMacAddress();
+        *os << " lladdr " << entry->GetMacAddress();
 
-        if (i->second->IsReachable())
+        if (entry->IsReachable())
         {
             *os << " REACHABLE\n";
         }
-        else if (i->second->IsDelay())
+        else if (entry->IsDelay())
         {
             *os << " DELAY\n";
         }
-        else if (i->second->IsIncomplete())
+        else if (entry->IsIncomplete())
         {
             *os << " INCOMPLETE\n";
         }
-        else if (i->second->IsProbe())
+        else if (entry->IsProbe())
         {
             *os << " PROBE\n";
         }
-        else if (i->second->IsStale())
+        else if (entry->IsStale())
         {
             *os << " STALE\n";
         }
-        else if (i->second->IsPermanent())
+        else if (entry->IsPermanent())
         {
             *os << " PERMANENT\n";
         }
-        else if (i->second->IsAutoGenerated())
+        else if (entry->IsAutoGenerated())
         {
             *os << " STATIC_AUTOGENERATED\n";
         }
@@ -719,6 +718,21 @@ NdiscCache::RemoveAutoGeneratedEntries()
     }
 }
 
+std::vector<NdiscCache::Entry*>
+NdiscCache::GetSortedEntries() const
+{
+    std::vector<NdiscCache::Entry*> entries;
+    entries.reserve(m_ndCache.size());
+    for (const auto& [address, entry] : m_ndCache)
+    {
+        entries.push_back(entry);
+    }
+    std::sort(entries.begin(), entries.end(), [](NdiscCache::Entry* a, NdiscCache::Entry* b) {
+        return a->GetIpv6Address() < b->GetIpv6Address();
+    });
+    return entries;
+}
+
 std::ostream&
 operator<<(std::ostream& os, const NdiscCache::Entry& entry)
 {
@@ -18,8 +18,9 @@
 #include "ns3/timer.h"
 
 #include <list>
-#include <map>
 #include <stdint.h>
+#include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -446,11 +447,21 @@ class NdiscCache : public Object
     /**
      * @brief Neighbor Discovery Cache container
      */
-    typedef std::map<Ipv6Address, NdiscCache::Entry*> Cache;
+    typedef std::unordered_map<Ipv6Address, NdiscCache::Entry*, Ipv6AddressHash> Cache;
     /**
      * @brief Neighbor Discovery Cache container iterator
      */
-    typedef std::map<Ipv6Address, NdiscCache::Entry*>::iterator CacheI;
+    typedef Cache::iterator CacheI;
+
+    /**
+     * @brief Get the entries of the cache sorted by IPv6 address.
+     *
+     * The cache is a hash table, so this is used wherever the iteration order is observable
+     * to keep it independent of the table layout.
+     *
+     * @return the cache entries, in increasing IPv6 address order
+     */
+    std::vector<NdiscCache::Entry*> GetSortedEntries() const;
 
     /**
      * @brief A list of Entry.
@@ -46,6 +46,7 @@
 #include "ns3/object.h"
 #include "ns3/packet.h"
 #include "ns3/pointer.h"
+#include "ns3/segmentation-offload-tag.h"
 #include "ns3/simulation-singleton.h"
 #include "ns3/simulator.h"
 #include "ns3/trace-source-accessor.h"
@@ -184,6 +185,14 @@ TcpSocketBase::GetTypeId()
                           BooleanValue(true),
                           MakeBooleanAccessor(&TcpSocketBase::m_limitedTx),
                           MakeBooleanChecker())
+            .AddAttribute("TsoMaxSegments",
+                          "Maximum number of segments of previously unsent data sent as a "
+                          "single TSO super-segment (1 disables segmentation offload "
+                          "emulation). Super-segments are kept whole only on devices supporting "
+                          "segmentation offload (point-to-point and simple devices).",
+                          UintegerValue(1),
+                          MakeUintegerAccessor(&TcpSocketBase::m_tsoMaxSegments),
+                          MakeUintegerChecker<uint16_t>(1))
             .AddAttribute("UseEcn",
                           "Parameter to set ECN functionality",
                           EnumValue(TcpSocketState::Off),
@@ -403,6 +412,7 @@ TcpSocketBase::TcpSocketBase(const TcpSocketBase& sock)
       m_recoverActive(sock.m_recoverActive),
       m_retxThresh(sock.m_retxThresh),
       m_limitedTx(sock.m_limitedTx),
+      m_tsoMaxSegments(sock.m_tsoMaxSegments),
       m_isFirstPartialAck(sock.m_isFirstPartialAck),
       m_txTrace(sock.m_txTrace),
       m_rxTrace(sock.m_rxTrace),
@@ -3243,6 +3253,14 @@ TcpSocketBase::SendDataPacket(SequenceNumber32 seq, uint32_t maxSize, bool withA
     bool isEct = IsEct(isRetransmission ? TcpPacketType_t::RE_XMT : TcpPacketType_t::DATA);
     AddSocketTags(p, isEct);
 
+    if (sz > m_tcb->m_segmentSize)
+    {
+        // TSO super-segment: let the lower layers know how many segments it stands for
+        auto segments =
+            static_cast<uint16_t>((sz + m_tcb->m_segmentSize - 1) / m_tcb->m_segmentSize);
+        p->AddPacketTag(SegmentationOffloadTag(segments, sz));
+    }
+
     if (m_closeOnEmpty && (remainingData == 0))
     {
         flags |= TcpHeader::FIN;
@@ -3464,7 +3482,20 @@ TcpSocketBase::SendPendingData(bool withAck)
                 break;
             }
 
-            uint32_t s = std::min(availableWindow, m_tcb->m_segmentSize);
+            // With segmentation offload, previously unsent data may leave as a single
+            // super-segment; retransmissions remain MSS-sized, as returned by NextSeg ()
+            uint32_t maxSegments = 1;
+            if (m_tsoMaxSegments > 1 && next >= m_tcb->m_highTxMark)
+            {
+                maxSegments = m_tsoMaxSegments;
+                SequenceNumber32 rWndEdge = m_highRxAckMark + SequenceNumber32(m_rWnd);
+                nextHigh = std::max(
+                    nextHigh,
+                    std::min(next + SequenceNumber32(maxSegments * m_tcb->m_segmentSize),
+                             rWndEdge));
+            }
+
+            uint32_t s = std::min(availableWindow, maxSegments * m_tcb->m_segmentSize);
             // NextSeg () may have further constrained the segment size
             auto maxSizeToSend = static_cast<uint32_t>(nextHigh - next);
             s = std::min(s, maxSizeToSend);
@@ -3622,6 +3653,11 @@ TcpSocketBase::ReceivedData(Ptr<Packet> p, const TcpHeader& tcpHeader)
     NS_LOG_DEBUG("Data segment, seq=" << tcpHeader.GetSequenceNumber()
                                       << " pkt size=" << p->GetSize());
 
+    // The segment count of a TSO super-segment is only needed by the ACK policy
+    // below: strip the tag, so that it does not reach the application
+    SegmentationOffloadTag offloadTag;
+    uint16_t segments = p->RemovePacketTag(offloadTag) ? offloadTag.GetSegments() : 1;
+
     // Put into Rx buffer
     SequenceNumber32 expectedSeq = m_tcb->m_rxBuffer->NextRxSequence();
     if (!m_tcb->m_rxBuffer->Add(p, tcpHeader))
@@ -3678,7 +3714,10 @@ TcpSocketBase::ReceivedData(Ptr<Packet> p, const TcpHeader& tcpHeader)
     }
     else
     { // In-sequence packet: ACK if delayed ack count allows
-        if (++m_delAckCount >= m_delAckMaxCount)
+        // A TSO super-segment counts for all of its segments, so that the ACKs
+        // of the segments it carries are coalesced (as GRO does)
+        m_delAckCount += segments;
+        if (m_delAckCount >= m_delAckMaxCount)
         {
             m_delAckEvent.Cancel();
             m_delAckCount = 0;
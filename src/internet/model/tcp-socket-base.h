@@ -1430,6 +1430,9 @@ class TcpSocketBase : public TcpSocket
     uint32_t m_retxThresh{3};    //!< Fast Retransmit threshold
     bool m_limitedTx{true};      //!< perform limited transmit
 
+    // Segmentation offload
+    uint16_t m_tsoMaxSegments{1}; //!< Maximum number of segments in a TSO super-segment
+
     // Transmission Control Block
     Ptr<TcpSocketState> m_tcb;                 //!< Congestion control information
     Ptr<TcpCongestionOps> m_congestionControl; //!< Congestion control
@@ -163,6 +163,7 @@ TcpTxBuffer::SetHeadSequence(const SequenceNumber32& seq)
     NS_ASSERT(m_sentList.empty());
     m_sackSeen = false;
     m_highestSack = std::make_pair(m_sentList.end(), SequenceNumber32(0));
+    ResetScoreboardIndex();
 }
 
 bool
@@ -347,21 +348,20 @@ TcpTxBuffer::FindHighestSacked() const
 {
     NS_LOG_FUNCTION(this);
 
-    SequenceNumber32 beginOfCurrentPacket = m_firstByteSeq;
-
-    auto ret = std::make_pair(m_sentList.end(), SequenceNumber32(0));
+    SequenceNumber32 beginOfCurrentPacket = m_firstByteSeq + m_sentSize;
 
-    for (auto it = m_sentList.begin(); it != m_sentList.end(); ++it)
+    // Walk backward: the first sacked item found is the highest one
+    for (auto it = m_sentList.rbegin(); it != m_sentList.rend(); ++it)
     {
         const TcpTxItem* item = *it;
+        beginOfCurrentPacket -= item->m_packet->GetSize();
         if (item->m_sacked)
         {
-            ret = std::make_pair(it, beginOfCurrentPacket);
+            return std::make_pair(std::prev(it.base()), beginOfCurrentPacket);
         }
-        beginOfCurrentPacket += item->m_packet->GetSize();
     }
 
-    return ret;
+    return std::make_pair(m_sentList.end(), SequenceNumber32(0));
 }
 
 void
@@ -743,6 +743,7 @@ TcpTxBuffer::DiscardUpTo(const SequenceNumber32& seq, const Callback<void, TcpTx
             // when adding Reno dupacks in the count.
             head->m_sacked = false;
             m_sackedOut -= head->m_packet->GetSize();
+            ResetScoreboardIndex();
             NS_LOG_INFO("Moving the SACK flag from the HEAD to another segment");
             AddRenoSack();
             MarkHeadAsLost();
@@ -759,6 +760,12 @@ TcpTxBuffer::DiscardUpTo(const SequenceNumber32& seq, const Callback<void, TcpTx
         m_highestSack = std::make_pair(m_sentList.end(), SequenceNumber32(0));
     }
 
+    // Forget the SACKed ranges that have been cumulatively acknowledged
+    while (!m_sackedRanges.empty() && m_sackedRanges.begin()->second <= m_firstByteSeq)
+    {
+        m_sackedRanges.erase(m_sackedRanges.begin());
+    }
+
     NS_LOG_DEBUG("Discarded up to " << seq << " lost: " << m_lostOut << " retrans: " << m_retrans
                                     << " sacked: " << m_sackedOut);
     NS_LOG_LOGIC("Buffer status after discarding data " << *this);
@@ -777,74 +784,32 @@ TcpTxBuffer::Update(const TcpOptionSack::SackList& list, const Callback<void, Tc
 
     for (auto option_it = list.begin(); option_it != list.end(); ++option_it)
     {
-        auto item_it = m_sentList.begin();
-        SequenceNumber32 beginOfCurrentPacket = m_firstByteSeq;
-
         if (m_firstByteSeq + m_sentSize < (*option_it).first)
         {
             NS_LOG_INFO("Not updating scoreboard, the option block is outside the sent list");
             return bytesSacked;
         }
 
-        while (item_it != m_sentList.end())
+        // Only search the sent list for the parts of the block that are not
+        // already known to be SACKed
+        SequenceNumber32 start = (*option_it).first;
+        while (start < (*option_it).second)
         {
-            uint32_t pktSize = (*item_it)->m_packet->GetSize();
-
-            // Check the boundary of this packet ... only mark as sacked if
-            // it is precisely mapped over the option. It means that if the receiver
-            // is reporting as sacked single range bytes that are not mapped 1:1
-            // in what we have, the option is discarded. There's room for improvement
-            // here.
-            if (beginOfCurrentPacket >= (*option_it).first &&
-                beginOfCurrentPacket + pktSize <= (*option_it).second)
+            auto next = m_sackedRanges.upper_bound(start);
+            if (next != m_sackedRanges.begin() && std::prev(next)->second > start)
             {
-                if ((*item_it)->m_sacked)
-                {
-                    NS_ASSERT(!(*item_it)->m_lost);
-                    NS_LOG_INFO("Received block " << *option_it << ", checking sentList for block "
-                                                  << *(*item_it)
-                                                  << ", found in the sackboard already sacked");
-                }
-                else
-                {
-                    if ((*item_it)->m_lost)
-                    {
-                        (*item_it)->m_lost = false;
-                        m_lostOut -= (*item_it)->m_packet->GetSize();
-                    }
-
-                    (*item_it)->m_sacked = true;
-                    m_sackedOut += (*item_it)->m_packet->GetSize();
-                    bytesSacked += (*item_it)->m_packet->GetSize();
-
-                    if (m_highestSack.first == m_sentList.end() ||
-                        m_highestSack.second <= beginOfCurrentPacket + pktSize)
-                    {
-                        m_sackSeen = true;
-                        m_highestSack = std::make_pair(item_it, beginOfCurrentPacket);
-                    }
-
-                    NS_LOG_INFO("Received block "
-                                << *option_it << ", checking sentList for block " << *(*item_it)
-                                << ", found in the sackboard, sacking, current highSack: "
-                                << m_highestSack.second);
-
-                    if (!sackedCb.IsNull())
-                    {
-                        sackedCb(*item_it);
-                    }
-                }
+                start = std::prev(next)->second;
+                continue;
             }
-            else if (beginOfCurrentPacket + pktSize > (*option_it).second)
+            SequenceNumber32 end = (*option_it).second;
+            if (next != m_sackedRanges.end() && next->first < end)
             {
-                // We already passed the received block end. Exit from the loop
-                NS_LOG_INFO("Received block [" << *option_it << ", checking sentList for block "
-                                               << *(*item_it) << "], not found, breaking loop");
-                break;
+                end = next->first;
             }
-
-            beginOfCurrentPacket += pktSize;
-            ++item_it;
+            NS_LOG_INFO("Received block " << *option_it << ", checking sentList for range ["
+                                          << start << ";" << end << "]");
+            bytesSacked += SackRange(start, end, sackedCb);
+            start = end;
         }
     }
 
@@ -862,12 +827,146 @@ TcpTxBuffer::Update(const TcpOptionSack::SackList& list, const Callback<void, Tc
     return bytesSacked;
 }
 
+uint32_t
+TcpTxBuffer::SackRange(const SequenceNumber32& start,
+                       const SequenceNumber32& end,
+                       const Callback<void, TcpTxItem*>& sackedCb)
+{
+    NS_LOG_FUNCTION(this << start << end);
+
+    // Find the first item that begins at or after start, walking from the
+    // closest known position
+    SequenceNumber32 tail = m_firstByteSeq + m_sentSize;
+    auto item_it = m_sentList.cbegin();
+    SequenceNumber32 beginOfCurrentPacket = m_firstByteSeq;
+
+    if (m_highestSack.first != m_sentList.end() && m_highestSack.second <= start &&
+        start - m_highestSack.second < tail - start)
+    {
+        item_it = m_highestSack.first;
+        beginOfCurrentPacket = m_highestSack.second;
+    }
+    else if (tail - start < start - m_firstByteSeq)
+    {
+        item_it = m_sentList.cend();
+        beginOfCurrentPacket = tail;
+        while (item_it != m_sentList.cbegin())
+        {
+            uint32_t pktSize = (*std::prev(item_it))->m_packet->GetSize();
+            if (beginOfCurrentPacket - pktSize < start)
+            {
+                break;
+            }
+            beginOfCurrentPacket -= pktSize;
+            --item_it;
+        }
+    }
+
+    while (item_it != m_sentList.end() && beginOfCurrentPacket < start)
+    {
+        beginOfCurrentPacket += (*item_it)->m_packet->GetSize();
+        ++item_it;
+    }
+
+    uint32_t bytesSacked = 0;
+    while (item_it != m_sentList.end())
+    {
+        uint32_t pktSize = (*item_it)->m_packet->GetSize();
+
+        // Check the boundary of this packet ... only mark as sacked if
+        // it is precisely mapped over the option. It means that if the receiver
+        // is reporting as sacked single range bytes that are not mapped 1:1
+        // in what we have, the option is discarded. There's room for improvement
+        // here.
+        if (beginOfCurrentPacket + pktSize > end)
+        {
+            // We already passed the received block end. Exit from the loop
+            NS_LOG_INFO("Checking sentList for block " << *(*item_it)
+                                                       << ", not found, breaking loop");
+            break;
+        }
+
+        if ((*item_it)->m_sacked)
+        {
+            NS_ASSERT(!(*item_it)->m_lost);
+            NS_LOG_INFO("Checking sentList for block " << *(*item_it)
+                                                       << ", found in the sackboard already sacked");
+        }
+        else
+        {
+            if ((*item_it)->m_lost)
+            {
+                (*item_it)->m_lost = false;
+                m_lostOut -= pktSize;
+            }
+
+            (*item_it)->m_sacked = true;
+            m_sackedOut += pktSize;
+            bytesSacked += pktSize;
+
+            if (m_highestSack.first == m_sentList.end() ||
+                m_highestSack.second <= beginOfCurrentPacket + pktSize)
+            {
+                m_sackSeen = true;
+                m_highestSack = std::make_pair(item_it, beginOfCurrentPacket);
+            }
+
+            NS_LOG_INFO("Checking sentList for block "
+                        << *(*item_it) << ", found in the sackboard, sacking, current highSack: "
+                        << m_highestSack.second);
+
+            if (!sackedCb.IsNull())
+            {
+                sackedCb(*item_it);
+            }
+        }
+        AddSackedRange(beginOfCurrentPacket, beginOfCurrentPacket + pktSize);
+
+        beginOfCurrentPacket += pktSize;
+        ++item_it;
+    }
+
+    return bytesSacked;
+}
+
+void
+TcpTxBuffer::AddSackedRange(const SequenceNumber32& start, const SequenceNumber32& end)
+{
+    NS_LOG_FUNCTION(this << start << end);
+
+    SequenceNumber32 rangeStart = start;
+    SequenceNumber32 rangeEnd = end;
+
+    // Merge with the adjacent or overlapping ranges
+    auto it = m_sackedRanges.upper_bound(rangeStart);
+    if (it != m_sackedRanges.begin() && std::prev(it)->second >= rangeStart)
+    {
+        --it;
+        rangeStart = it->first;
+        rangeEnd = std::max(rangeEnd, it->second);
+        it = m_sackedRanges.erase(it);
+    }
+    while (it != m_sackedRanges.end() && it->first <= rangeEnd)
+    {
+        rangeEnd = std::max(rangeEnd, it->second);
+        it = m_sackedRanges.erase(it);
+    }
+    m_sackedRanges.emplace_hint(it, rangeStart, rangeEnd);
+}
+
+void
+TcpTxBuffer::ResetScoreboardIndex()
+{
+    NS_LOG_FUNCTION(this);
+    m_sackedRanges.clear();
+    m_lostFrontier = m_firstByteSeq;
+}
+
 void
 TcpTxBuffer::UpdateLostCount()
 {
     NS_LOG_FUNCTION(this);
     uint32_t sacked = 0;
-    SequenceNumber32 beginOfCurrentPacket = m_highestSack.second;
     if (m_highestSack.first == m_sentList.end())
     {
         NS_LOG_INFO("Status before the update: " << *this
@@ -879,23 +978,37 @@ TcpTxBuffer::UpdateLostCount()
                                                  << *(*m_highestSack.first));
     }
 
+    if (m_lostFrontier < m_firstByteSeq || m_lostFrontier > m_firstByteSeq + m_sentSize)
+    {
+        m_lostFrontier = m_firstByteSeq;
+    }
+
+    SequenceNumber32 newFrontier = m_lostFrontier;
     for (auto it = m_highestSack.first; it != m_sentList.begin(); --it)
     {
         TcpTxItem* item = *it;
         if (item->m_sacked)
         {
             sacked++;
+            if (sacked == m_dupAckThresh)
+            {
+                newFrontier = std::max(newFrontier, item->m_startSeq);
+            }
         }
 
         if (sacked >= m_dupAckThresh)
         {
+            if (item->m_startSeq + item->m_packet->GetSize() <= m_lostFrontier)
+            {
+                // Everything below has already been marked by a previous update
+                break;
+            }
             if (!item->m_sacked && !item->m_lost)
             {
                 item->m_lost = true;
                 m_lostOut += item->m_packet->GetSize();
             }
         }
-        beginOfCurrentPacket -= item->m_packet->GetSize();
     }
 
     if (sacked >= m_dupAckThresh)
@@ -906,6 +1019,7 @@ TcpTxBuffer::UpdateLostCount()
             item->m_lost = true;
             m_lostOut += item->m_packet->GetSize();
         }
+        m_lostFrontier = newFrontier;
     }
     NS_LOG_INFO("Status after the update: " << *this);
     ConsistencyCheck();
@@ -925,8 +1039,13 @@ TcpTxBuffer::IsLost(const SequenceNumber32& seq) const
     // performance
     for (auto it = m_sentList.begin(); it != m_sentList.end(); ++it)
     {
+        if (seq < (*it)->m_startSeq)
+        {
+            // The list is sorted, seq is not in any of the remaining items
+            break;
+        }
         // Search for the right iterator before calling IsLost()
-        if ((*it)->m_startSeq <= seq && seq < (*it)->m_startSeq + (*it)->m_packet->GetSize())
+        if (seq < (*it)->m_startSeq + (*it)->m_packet->GetSize())
         {
             if ((*it)->m_lost)
             {
@@ -972,6 +1091,17 @@ TcpTxBuffer::NextSeg(SequenceNumber32* seq, SequenceNumber32* seqHigh, bool isRe
     {
         item = *it;
 
+        if (m_sackSeen && item->m_startSeq >= m_highestSack.second)
+        {
+            // Condition 1.b cannot hold for this item and for the following ones
+            break;
+        }
+        if (m_lostOut == 0 && (isSeqPerRule3Valid || !isRecovery))
+        {
+            // No item can satisfy condition 1.c, and rule 3 has nothing more to find
+            break;
+        }
+
         // Condition 1.a , 1.b , and 1.c
         if (!item->m_retrans && !item->m_sacked &&
             ((m_sackSeen && item->m_startSeq < m_highestSack.second) || !m_sackSeen))
@@ -1205,6 +1335,7 @@ TcpTxBuffer::ResetRenoSack()
 
     m_highestSack = std::make_pair(m_sentList.end(), SequenceNumber32(0));
     m_sackSeen = false;
+    ResetScoreboardIndex();
 }
 
 void
@@ -1235,6 +1366,7 @@ TcpTxBuffer::ResetSentList()
     m_sackedOut = 0;
     m_sackSeen = false;
     m_highestSack = std::make_pair(m_sentList.end(), SequenceNumber32(0));
+    ResetScoreboardIndex();
 }
 
 void
@@ -1268,6 +1400,7 @@ TcpTxBuffer::SetSentListLost(bool resetSack)
         m_lostOut = m_sentSize;
         m_sackSeen = false;
         m_highestSack = std::make_pair(m_sentList.end(), SequenceNumber32(0));
+        ResetScoreboardIndex();
     }
     else
     {
@@ -1347,6 +1480,7 @@ TcpTxBuffer::MarkHeadAsLost()
         {
             m_sentList.front()->m_sacked = false;
             m_sackedOut -= m_sentList.front()->m_packet->GetSize();
+            ResetScoreboardIndex();
         }
 
         if (m_sentList.front()->m_retrans)
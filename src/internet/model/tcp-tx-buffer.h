@@ -18,6 +18,8 @@
 #include "ns3/sequence-number.h"
 #include "ns3/traced-value.h"
 
+#include <map>
+
 namespace ns3
 {
 class Packet;
@@ -418,12 +420,44 @@ class TcpTxBuffer : public Object
      * The {New}Reno cases, for now, are managed in TcpSocketBase through the
      * call to MarkHeadAsLost.
      * This function is, therefore, called after a SACK option has been received,
-     * and updates the lost count. It can be probably optimized by not walking
-     * the entire list, but a subset.
+     * and updates the lost count. The walk starts from the highest SACKed
+     * segment and stops at m_lostFrontier, below which every un-SACKed
+     * segment has already been marked as lost by a previous call.
      *
      */
     void UpdateLostCount();
 
+    /**
+     * @brief Mark as SACKed the sent segments that lie entirely in a range.
+     *
+     * The walk over the sent list starts from the closest known position
+     * (head, highest SACKed segment or tail), so its cost is proportional to
+     * the distance from that position rather than to the window size.
+     *
+     * @param start first byte of the range
+     * @param end first byte after the range
+     * @param sackedCb callback invoked for each newly SACKed segment
+     * @return the number of newly SACKed bytes
+     */
+    uint32_t SackRange(const SequenceNumber32& start,
+                       const SequenceNumber32& end,
+                       const Callback<void, TcpTxItem*>& sackedCb);
+
+    /**
+     * @brief Record that all the sent segments in a range are SACKed.
+     * @param start first byte of the range
+     * @param end first byte after the range
+     */
+    void AddSackedRange(const SequenceNumber32& start, const SequenceNumber32& end);
+
+    /**
+     * @brief Forget the SACKed ranges and the lost frontier.
+     *
+     * Must be called every time the SACKed or lost flags of the sent
+     * segments are cleared.
+     */
+    void ResetScoreboardIndex();
+
     /**
      * @brief Remove the size specified from the lostOut, retrans, sacked count
      *
@@ -603,6 +637,19 @@ class TcpTxBuffer : public Object
         m_firstByteSeq; //!< Sequence number of the first byte in data (SND.UNA)
     std::pair<PacketList::const_iterator, SequenceNumber32> m_highestSack; //!< Highest SACK byte
 
+    /**
+     * Disjoint sequence ranges (start, end) in which every sent segment is
+     * SACKed. SACK blocks are checked against these ranges, so that only the
+     * newly SACKed part of a block is searched in the sent list.
+     */
+    std::map<SequenceNumber32, SequenceNumber32> m_sackedRanges;
+
+    /**
+     * Every un-SACKed segment ending at or before this sequence is marked
+     * as lost. Used to bound the walk in UpdateLostCount.
+     */
+    SequenceNumber32 m_lostFrontier{0};
+
     uint32_t m_lostOut{0};   //!< Number of lost bytes
     uint32_t m_sackedOut{0}; //!< Number of sacked bytes
     uint32_t m_retrans{0};   //!< Number of retransmitted bytes
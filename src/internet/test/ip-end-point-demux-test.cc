@@ -0,0 +1,205 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/ipv4-end-point-demux.h"
+#include "ns3/ipv4-end-point.h"
+#include "ns3/ipv4-interface-address.h"
+#include "ns3/ipv4-interface.h"
+#include "ns3/ipv6-end-point-demux.h"
+#include "ns3/ipv6-end-point.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+/**
+ * @ingroup internet-test
+ *
+ * @brief Ipv4EndPointDemux lookup test.
+ *
+ * Checks that the most specific end point is returned, that the four-tuple
+ * index follows the changes of the end point addresses, and that
+ * deallocated end points are no longer found.
+ */
+class Ipv4EndPointDemuxTestCase : public TestCase
+{
+  public:
+    Ipv4EndPointDemuxTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+Ipv4EndPointDemuxTestCase::Ipv4EndPointDemuxTestCase()
+    : TestCase("Ipv4EndPointDemux lookup")
+{
+}
+
+void
+Ipv4EndPointDemuxTestCase::DoRun()
+{
+    Ipv4EndPointDemux demux;
+    Ipv4Address local("10.0.0.1");
+    Ipv4Address peer1("10.0.0.2");
+    Ipv4Address peer2("10.0.0.3");
+
+    Ipv4EndPoint* listener = demux.Allocate(nullptr, 80);
+    NS_TEST_ASSERT_MSG_NE(listener, nullptr, "Listener allocation failed");
+    NS_TEST_EXPECT_MSG_EQ(demux.Allocate(nullptr, 80), nullptr, "Duplicated listener allowed");
+    NS_TEST_EXPECT_MSG_EQ(demux.LookupPortLocal(80), true, "Port 80 should be in use");
+    NS_TEST_EXPECT_MSG_EQ(demux.LookupPortLocal(81), false, "Port 81 should be free");
+
+    Ipv4EndPointDemux::EndPoints found = demux.Lookup(local, 80, peer1, 1000, nullptr);
+    NS_TEST_ASSERT_MSG_EQ(found.size(), 1, "Wildcard listener not found");
+    NS_TEST_EXPECT_MSG_EQ(found.front(), listener, "Wrong end point");
+    NS_TEST_EXPECT_MSG_EQ(demux.Lookup(local, 81, peer1, 1000, nullptr).size(),
+                          0,
+                          "Unexpected end point on port 81");
+
+    // Many connections on the listening port, each one with its own four-tuple
+    std::vector<Ipv4EndPoint*> connections;
+    for (uint16_t port = 1000; port < 1100; port++)
+    {
+        connections.push_back(demux.Allocate(nullptr, local, 80, peer1, port));
+    }
+    NS_TEST_EXPECT_MSG_EQ(demux.Allocate(nullptr, local, 80, peer1, 1000),
+                          nullptr,
+                          "Duplicated connection allowed");
+    for (uint16_t port = 1000; port < 1100; port++)
+    {
+        found = demux.Lookup(local, 80, peer1, port, nullptr);
+        NS_TEST_ASSERT_MSG_EQ(found.size(), 1, "Connection not found");
+        NS_TEST_EXPECT_MSG_EQ(found.front(), connections[port - 1000], "Wrong connection");
+    }
+    found = demux.Lookup(local, 80, peer2, 1000, nullptr);
+    NS_TEST_ASSERT_MSG_EQ(found.size(), 1, "Listener not found");
+    NS_TEST_EXPECT_MSG_EQ(found.front(), listener, "Unknown peer should reach the listener");
+    NS_TEST_EXPECT_MSG_EQ(demux.SimpleLookup(local, 80, peer1, 1005),
+                          connections[5],
+                          "SimpleLookup exact match failed");
+    NS_TEST_EXPECT_MSG_EQ(demux.SimpleLookup(local, 80, peer2, 1005),
+                          connections[0],
+                          "SimpleLookup should return the least generic end point");
+
+    // An end point with an exact local address wins over the wildcard one
+    Ipv4EndPoint* bound = demux.Allocate(nullptr, local, 80);
+    found = demux.Lookup(local, 80, peer2, 1000, nullptr);
+    NS_TEST_ASSERT_MSG_EQ(found.size(), 1, "Bound listener not found");
+    NS_TEST_EXPECT_MSG_EQ(found.front(), bound, "Bound listener should be preferred");
+    demux.DeAllocate(bound);
+
+    // Changing the peer of an end point moves it in the four-tuple index
+    Ipv4EndPoint* client = demux.Allocate(local);
+    NS_TEST_ASSERT_MSG_NE(client, nullptr, "Ephemeral allocation failed");
+    uint16_t ephemeral = client->GetLocalPort();
+    client->SetPeer(peer2, 8080);
+    found = demux.Lookup(local, ephemeral, peer2, 8080, nullptr);
+    NS_TEST_ASSERT_MSG_EQ(found.size(), 1, "Connected end point not found");
+    NS_TEST_EXPECT_MSG_EQ(found.front(), client, "Wrong connected end point");
+    NS_TEST_EXPECT_MSG_EQ(demux.Lookup(local, ephemeral, peer1, 8080, nullptr).size(),
+                          0,
+                          "Connected end point matched the wrong peer");
+    Ipv4EndPoint* next = demux.Allocate();
+    NS_TEST_EXPECT_MSG_NE(next->GetLocalPort(), ephemeral, "Ephemeral port reused");
+
+    // Deallocated end points are no longer found
+    demux.DeAllocate(connections[5]);
+    found = demux.Lookup(local, 80, peer1, 1005, nullptr);
+    NS_TEST_ASSERT_MSG_EQ(found.size(), 1, "Listener not found");
+    NS_TEST_EXPECT_MSG_EQ(found.front(), listener, "Deallocated connection still found");
+    demux.DeAllocate(client);
+    NS_TEST_EXPECT_MSG_EQ(demux.LookupPortLocal(ephemeral), false, "Port not released");
+
+    // Disabled end points are skipped
+    listener->SetRxEnabled(false);
+    NS_TEST_EXPECT_MSG_EQ(demux.Lookup(local, 80, peer2, 1000, nullptr).size(),
+                          0,
+                          "Disabled listener found");
+    listener->SetRxEnabled(true);
+
+    // Subnet-directed broadcast listeners
+    Ptr<Ipv4Interface> interface = CreateObject<Ipv4Interface>();
+    interface->AddAddress(Ipv4InterfaceAddress(local, Ipv4Mask("255.255.255.0")));
+    Ipv4EndPoint* subnet = demux.Allocate(nullptr, Ipv4Address("10.0.0.0"), 9);
+    found = demux.Lookup(Ipv4Address("10.0.0.255"), 9, peer1, 1000, interface);
+    NS_TEST_ASSERT_MSG_EQ(found.size(), 1, "Subnet-directed listener not found");
+    NS_TEST_EXPECT_MSG_EQ(found.front(), subnet, "Wrong subnet-directed listener");
+    found = demux.Lookup(Ipv4Address("10.0.1.255"), 9, peer1, 1000, interface);
+    NS_TEST_EXPECT_MSG_EQ(found.size(), 0, "Subnet-directed listener matched another subnet");
+    interface->Dispose();
+}
+
+/**
+ * @ingroup internet-test
+ *
+ * @brief Ipv6EndPointDemux lookup test.
+ */
+class Ipv6EndPointDemuxTestCase : public TestCase
+{
+  public:
+    Ipv6EndPointDemuxTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+Ipv6EndPointDemuxTestCase::Ipv6EndPointDemuxTestCase()
+    : TestCase("Ipv6EndPointDemux lookup")
+{
+}
+
+void
+Ipv6EndPointDemuxTestCase::DoRun()
+{
+    Ipv6EndPointDemux demux;
+    Ipv6Address local("2001:db8::1");
+    Ipv6Address peer1("2001:db8::2");
+    Ipv6Address peer2("2001:db8::3");
+
+    Ipv6EndPoint* listener = demux.Allocate(nullptr, 80);
+    Ipv6EndPoint* connection = demux.Allocate(nullptr, local, 80, peer1, 1000);
+    NS_TEST_EXPECT_MSG_EQ(demux.Allocate(nullptr, local, 80, peer1, 1000),
+                          nullptr,
+                          "Duplicated connection allowed");
+
+    Ipv6EndPointDemux::EndPoints found = demux.Lookup(local, 80, peer1, 1000, nullptr);
+    NS_TEST_ASSERT_MSG_EQ(found.size(), 1, "Connection not found");
+    NS_TEST_EXPECT_MSG_EQ(found.front(), connection, "Wrong connection");
+    found = demux.Lookup(local, 80, peer2, 1000, nullptr);
+    NS_TEST_ASSERT_MSG_EQ(found.size(), 1, "Listener not found");
+    NS_TEST_EXPECT_MSG_EQ(found.front(), listener, "Wrong listener");
+
+    // Changing the local address or port moves the end point in the indexes
+    Ipv6EndPoint* client = demux.Allocate();
+    client->SetLocalAddress(local);
+    client->SetPeer(peer2, 8080);
+    client->SetLocalPort(5000);
+    NS_TEST_EXPECT_MSG_EQ(demux.LookupPortLocal(5000), true, "Port 5000 should be in use");
+    found = demux.Lookup(local, 5000, peer2, 8080, nullptr);
+    NS_TEST_ASSERT_MSG_EQ(found.size(), 1, "Connected end point not found");
+    NS_TEST_EXPECT_MSG_EQ(found.front(), client, "Wrong connected end point");
+
+    demux.DeAllocate(connection);
+    found = demux.Lookup(local, 80, peer1, 1000, nullptr);
+    NS_TEST_ASSERT_MSG_EQ(found.size(), 1, "Listener not found");
+    NS_TEST_EXPECT_MSG_EQ(found.front(), listener, "Deallocated connection still found");
+    NS_TEST_EXPECT_MSG_EQ(demux.GetEndPoints().size(), 2, "Wrong number of end points");
+}
+
+/**
+ * @ingroup internet-test
+ *
+ * @brief IP end point demux TestSuite
+ */
+class EndPointDemuxTestSuite : public TestSuite
+{
+  public:
+    EndPointDemuxTestSuite()
+        : TestSuite("ip-end-point-demux", Type::UNIT)
+    {
+        AddTestCase(new Ipv4EndPointDemuxTestCase, TestCase::Duration::QUICK);
+        AddTestCase(new Ipv6EndPointDemuxTestCase, TestCase::Duration::QUICK);
+    }
+};
+
+static EndPointDemuxTestSuite g_endPointDemuxTestSuite; //!< Static variable for test initialization
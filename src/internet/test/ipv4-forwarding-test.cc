@@ -39,6 +39,7 @@ using namespace ns3;
 class Ipv4ForwardingTest : public TestCase
 {
     Ptr<Packet> m_receivedPacket; //!< Received packet
+    bool m_fastForwarding;        //!< Enable the FastForwarding mode of the router
 
     /**
      * @brief Send data.
@@ -55,7 +56,11 @@ class Ipv4ForwardingTest : public TestCase
 
   public:
     void DoRun() override;
-    Ipv4ForwardingTest();
+    /**
+     * @brief Constructor.
+     * @param fastForwarding enable the FastForwarding mode of the router
+     */
+    Ipv4ForwardingTest(bool fastForwarding);
 
     /**
      * @brief Receive data.
@@ -64,8 +69,10 @@ class Ipv4ForwardingTest : public TestCase
     void ReceivePkt(Ptr<Socket> socket);
 };
 
-Ipv4ForwardingTest::Ipv4ForwardingTest()
-    : TestCase("UDP socket implementation")
+Ipv4ForwardingTest::Ipv4ForwardingTest(bool fastForwarding)
+    : TestCase(std::string("UDP socket implementation") +
+               (fastForwarding ? " with fast forwarding" : "")),
+      m_fastForwarding(fastForwarding)
 {
 }
 
@@ -129,6 +136,8 @@ Ipv4ForwardingTest::DoRun()
     Ptr<Node> fwNode = CreateObject<Node>();
 
     internet.Install(fwNode);
+    fwNode->GetObject<Ipv4L3Protocol>()->SetAttribute("FastForwarding",
+                                                      BooleanValue(m_fastForwarding));
     Ptr<SimpleNetDevice> fwDev1;
     Ptr<SimpleNetDevice> fwDev2;
     { // first interface
@@ -191,6 +200,7 @@ Ipv4ForwardingTest::DoRun()
                           0,
                           "trivial");
     rxSocket->SetRecvCallback(MakeCallback(&Ipv4ForwardingTest::ReceivePkt, this));
+    rxSocket->SetIpRecvTtl(true);
 
     Ptr<SocketFactory> txSocketFactory = txNode->GetObject<UdpSocketFactory>();
     Ptr<Socket> txSocket = txSocketFactory->CreateSocket();
@@ -198,12 +208,24 @@ Ipv4ForwardingTest::DoRun()
 
     // ------ Now the tests ------------
 
-    // Unicast test
-    SendData(txSocket, "10.0.0.2");
-    NS_TEST_EXPECT_MSG_EQ(m_receivedPacket->GetSize(), 123, "IPv4 Forwarding on");
+    // Unicast test, twice so that the second packet follows the cached forwarding decision
+    for (uint32_t i = 0; i < 2; ++i)
+    {
+        SendData(txSocket, "10.0.0.2");
+        NS_TEST_EXPECT_MSG_EQ(m_receivedPacket->GetSize(), 123, "IPv4 Forwarding on");
+        SocketIpTtlTag ttlTag;
+        NS_TEST_EXPECT_MSG_EQ(m_receivedPacket->PeekPacketTag(ttlTag), true, "TTL not reported");
+        NS_TEST_EXPECT_MSG_EQ(+ttlTag.GetTtl(), 63, "TTL not decremented by the router");
+
+        m_receivedPacket->RemoveAllByteTags();
+        m_receivedPacket = nullptr;
+    }
 
-    m_receivedPacket->RemoveAllByteTags();
-    m_receivedPacket = nullptr;
+    // A packet whose TTL expires at the router is dropped
+    txSocket->SetIpTtl(1);
+    SendData(txSocket, "10.0.0.2");
+    NS_TEST_EXPECT_MSG_EQ(m_receivedPacket->GetSize(), 0, "IPv4 TTL expired");
+    txSocket->SetIpTtl(64);
 
     Ptr<Ipv4> ipv4 = fwNode->GetObject<Ipv4>();
     ipv4->SetAttribute("IpForward", BooleanValue(false));
@@ -229,7 +251,8 @@ class Ipv4ForwardingTestSuite : public TestSuite
 Ipv4ForwardingTestSuite::Ipv4ForwardingTestSuite()
     : TestSuite("ipv4-forwarding", Type::UNIT)
 {
-    AddTestCase(new Ipv4ForwardingTest, TestCase::Duration::QUICK);
+    AddTestCase(new Ipv4ForwardingTest(false), TestCase::Duration::QUICK);
+    AddTestCase(new Ipv4ForwardingTest(true), TestCase::Duration::QUICK);
 }
 
 static Ipv4ForwardingTestSuite
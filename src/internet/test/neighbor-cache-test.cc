@@ -617,6 +617,135 @@ ChannelTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * @ingroup internet-test
+ *
+ * @brief Neighbor cache on a Channel shared by several subnets Test
+ *
+ * The channel carries two IPv4 and two IPv6 subnets, plus secondary addresses with a wider mask
+ * or prefix. The caches populated for the whole channel at once are checked against the expected
+ * entries and against the caches populated device by device.
+ */
+class ChannelSubnetsTest : public TestCase
+{
+  public:
+    void DoRun() override;
+    ChannelSubnetsTest();
+
+  private:
+    /**
+     * @brief Build the topology, populate the neighbor caches and print them.
+     * @param perChannel populate the caches for the whole channel rather than per device
+     * @return the printed ARP and NDISC caches of all the nodes
+     */
+    std::pair<std::string, std::string> PopulateAndPrint(bool perChannel);
+};
+
+ChannelSubnetsTest::ChannelSubnetsTest()
+    : TestCase("The ChannelSubnetsTest Check if neighbor caches are correctly populated on a "
+               "channel shared by several subnets.")
+{
+}
+
+std::pair<std::string, std::string>
+ChannelSubnetsTest::PopulateAndPrint(bool perChannel)
+{
+    Mac48Address::ResetAllocationIndex();
+    NodeContainer nodes;
+    nodes.Create(5);
+
+    Ptr<SimpleChannel> channel = CreateObject<SimpleChannel>();
+    SimpleNetDeviceHelper simpleHelper;
+    NetDeviceContainer net = simpleHelper.Install(nodes, channel);
+
+    InternetStackHelper internet;
+    internet.Install(nodes);
+
+    // Setup IPv4 addresses: two subnets, node 0 also in the second one and node 4 in a wider one
+    Ipv4AddressHelper ipv4;
+    ipv4.SetBase("10.1.1.0", "255.255.255.0");
+    ipv4.Assign(NetDeviceContainer(net.Get(0), net.Get(1)));
+    ipv4.Assign(net.Get(2));
+    ipv4.SetBase("10.1.2.0", "255.255.255.0");
+    ipv4.Assign(NetDeviceContainer(net.Get(3), net.Get(4)));
+    Ptr<Ipv4> ipv4Node0 = nodes.Get(0)->GetObject<Ipv4>();
+    ipv4Node0->AddAddress(ipv4Node0->GetInterfaceForDevice(net.Get(0)),
+                          Ipv4InterfaceAddress("10.1.2.10", "255.255.255.0"));
+    Ptr<Ipv4> ipv4Node4 = nodes.Get(4)->GetObject<Ipv4>();
+    ipv4Node4->AddAddress(ipv4Node4->GetInterfaceForDevice(net.Get(4)),
+                          Ipv4InterfaceAddress("10.1.3.1", "255.255.0.0"));
+
+    // Setup IPv6 addresses, the same way
+    Ipv6AddressHelper ipv6;
+    ipv6.SetBase(Ipv6Address("2001:1::"), Ipv6Prefix(64));
+    ipv6.Assign(NetDeviceContainer(net.Get(0), net.Get(1)));
+    ipv6.Assign(net.Get(2));
+    ipv6.SetBase(Ipv6Address("2001:2::"), Ipv6Prefix(64));
+    ipv6.Assign(NetDeviceContainer(net.Get(3), net.Get(4)));
+    Ptr<Ipv6> ipv6Node4 = nodes.Get(4)->GetObject<Ipv6>();
+    ipv6Node4->AddAddress(ipv6Node4->GetInterfaceForDevice(net.Get(4)),
+                          Ipv6InterfaceAddress(Ipv6Address("2001:1:0:5::1"), Ipv6Prefix(48)));
+
+    NeighborCacheHelper neighborCache;
+    if (perChannel)
+    {
+        neighborCache.PopulateNeighborCache(channel);
+    }
+    else
+    {
+        neighborCache.PopulateNeighborCache(net);
+    }
+
+    std::ostringstream stringStreamv4;
+    Ptr<OutputStreamWrapper> arpStream = Create<OutputStreamWrapper>(&stringStreamv4);
+    std::ostringstream stringStreamv6;
+    Ptr<OutputStreamWrapper> ndiscStream = Create<OutputStreamWrapper>(&stringStreamv6);
+
+    // Print cache.
+    Ipv4RoutingHelper::PrintNeighborCacheAllAt(Seconds(0), arpStream);
+    Ipv6RoutingHelper::PrintNeighborCacheAllAt(Seconds(0), ndiscStream);
+
+    Simulator::Run();
+    Simulator::Destroy();
+    return {stringStreamv4.str(), stringStreamv6.str()};
+}
+
+void
+ChannelSubnetsTest::DoRun()
+{
+    auto [arpPerChannel, ndiscPerChannel] = PopulateAndPrint(true);
+    auto [arpPerDevice, ndiscPerDevice] = PopulateAndPrint(false);
+
+    constexpr auto arpCache =
+        "ARP Cache of node 0 at time 0\n"
+        "10.1.1.2 dev 0 lladdr 04-06-00:00:00:00:00:02 STATIC_AUTOGENERATED\n"
+        "10.1.1.3 dev 0 lladdr 04-06-00:00:00:00:00:03 STATIC_AUTOGENERATED\n"
+        "10.1.2.1 dev 0 lladdr 04-06-00:00:00:00:00:04 STATIC_AUTOGENERATED\n"
+        "10.1.2.2 dev 0 lladdr 04-06-00:00:00:00:00:05 STATIC_AUTOGENERATED\n"
+        "ARP Cache of node 1 at time 0\n"
+        "10.1.1.1 dev 0 lladdr 04-06-00:00:00:00:00:01 STATIC_AUTOGENERATED\n"
+        "10.1.1.3 dev 0 lladdr 04-06-00:00:00:00:00:03 STATIC_AUTOGENERATED\n"
+        "ARP Cache of node 2 at time 0\n"
+        "10.1.1.1 dev 0 lladdr 04-06-00:00:00:00:00:01 STATIC_AUTOGENERATED\n"
+        "10.1.1.2 dev 0 lladdr 04-06-00:00:00:00:00:02 STATIC_AUTOGENERATED\n"
+        "ARP Cache of node 3 at time 0\n"
+        "10.1.2.2 dev 0 lladdr 04-06-00:00:00:00:00:05 STATIC_AUTOGENERATED\n"
+        "10.1.2.10 dev 0 lladdr 04-06-00:00:00:00:00:01 STATIC_AUTOGENERATED\n"
+        "ARP Cache of node 4 at time 0\n"
+        "10.1.1.1 dev 0 lladdr 04-06-00:00:00:00:00:01 STATIC_AUTOGENERATED\n"
+        "10.1.1.2 dev 0 lladdr 04-06-00:00:00:00:00:02 STATIC_AUTOGENERATED\n"
+        "10.1.1.3 dev 0 lladdr 04-06-00:00:00:00:00:03 STATIC_AUTOGENERATED\n"
+        "10.1.2.1 dev 0 lladdr 04-06-00:00:00:00:00:04 STATIC_AUTOGENERATED\n"
+        "10.1.2.10 dev 0 lladdr 04-06-00:00:00:00:00:01 STATIC_AUTOGENERATED\n";
+    NS_TEST_EXPECT_MSG_EQ(arpPerChannel, arpCache, "Arp cache is incorrect.");
+    NS_TEST_EXPECT_MSG_EQ(arpPerChannel,
+                          arpPerDevice,
+                          "Arp cache populated per channel differs from the per device one.");
+    NS_TEST_EXPECT_MSG_EQ(ndiscPerChannel,
+                          ndiscPerDevice,
+                          "Ndisc cache populated per channel differs from the per device one.");
+}
+
 /**
  * @ingroup internet-test
  *
@@ -1223,6 +1352,7 @@ class NeighborCacheTestSuite : public TestSuite
     {
         AddTestCase(new DynamicNeighborCacheTest, TestCase::Duration::QUICK);
         AddTestCase(new ChannelTest, TestCase::Duration::QUICK);
+        AddTestCase(new ChannelSubnetsTest, TestCase::Duration::QUICK);
         AddTestCase(new NetDeviceContainerTest, TestCase::Duration::QUICK);
         AddTestCase(new InterfaceContainerTest, TestCase::Duration::QUICK);
         AddTestCase(new FlushTest, TestCase::Duration::QUICK);
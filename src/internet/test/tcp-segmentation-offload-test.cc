@@ -0,0 +1,373 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "tcp-error-model.h"
+#include "tcp-general-test.h"
+
+#include "ns3/inet-socket-address.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-address-helper.h"
+#include "ns3/ipv4-global-routing-helper.h"
+#include "ns3/log.h"
+#include "ns3/node.h"
+#include "ns3/queue.h"
+#include "ns3/segmentation-offload-tag.h"
+#include "ns3/simple-channel.h"
+#include "ns3/simple-net-device-helper.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/simulator.h"
+#include "ns3/tcp-header.h"
+#include "ns3/tcp-socket-factory.h"
+#include "ns3/uinteger.h"
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("TcpSegmentationOffloadTest");
+
+/**
+ * @ingroup internet-test
+ *
+ * @brief Check the TCP segmentation offload (TSO) emulation.
+ *
+ * The application writes four segments at a time, so that with TSO enabled
+ * each write leaves the sender as a single super-segment. The test checks
+ * that no packet exceeds the configured number of segments, that
+ * retransmissions (if a super-segment is dropped) are MSS-sized, that the
+ * receiver ACKs each super-segment at once, and that all the data is
+ * delivered.
+ */
+class TcpSegmentationOffloadTestCase : public TcpGeneralTest
+{
+  public:
+    /**
+     * @brief Constructor.
+     * @param desc Test description.
+     * @param tsoMaxSegments Maximum number of segments in a super-segment.
+     * @param dropSeq Sequence number of the data packet to drop (0 for no drop).
+     */
+    TcpSegmentationOffloadTestCase(const std::string& desc,
+                                   uint16_t tsoMaxSegments,
+                                   uint32_t dropSeq);
+
+  protected:
+    void ConfigureEnvironment() override;
+    void ConfigureProperties() override;
+    Ptr<TcpSocketMsgBase> CreateSenderSocket(Ptr<Node> node) override;
+    Ptr<ErrorModel> CreateReceiverErrorModel() override;
+    void Tx(const Ptr<const Packet> p, const TcpHeader& h, SocketWho who) override;
+    void Rx(const Ptr<const Packet> p, const TcpHeader& h, SocketWho who) override;
+    void FinalChecks() override;
+
+  private:
+    uint16_t m_tsoMaxSegments;       //!< Maximum number of segments in a super-segment
+    uint32_t m_dropSeq;              //!< Sequence number to drop
+    SequenceNumber32 m_highestTx{0}; //!< Highest sequence number sent
+    SequenceNumber32 m_highestRx{0}; //!< Highest sequence number received
+    uint32_t m_superSegments{0};     //!< Number of super-segments sent
+    uint32_t m_retransmissions{0};   //!< Number of retransmissions
+    uint32_t m_rxSuperSegments{0};   //!< Number of in-order super-segments received
+    uint32_t m_receiverAcks{0};      //!< Number of pure ACKs sent by the receiver
+};
+
+TcpSegmentationOffloadTestCase::TcpSegmentationOffloadTestCase(const std::string& desc,
+                                                               uint16_t tsoMaxSegments,
+                                                               uint32_t dropSeq)
+    : TcpGeneralTest(desc),
+      m_tsoMaxSegments(tsoMaxSegments),
+      m_dropSeq(dropSeq)
+{
+}
+
+void
+TcpSegmentationOffloadTestCase::ConfigureEnvironment()
+{
+    TcpGeneralTest::ConfigureEnvironment();
+    SetAppPktSize(2000);
+    SetAppPktCount(20);
+}
+
+void
+TcpSegmentationOffloadTestCase::ConfigureProperties()
+{
+    TcpGeneralTest::ConfigureProperties();
+    SetInitialCwnd(SENDER, 10);
+}
+
+Ptr<TcpSocketMsgBase>
+TcpSegmentationOffloadTestCase::CreateSenderSocket(Ptr<Node> node)
+{
+    Ptr<TcpSocketMsgBase> socket = TcpGeneralTest::CreateSenderSocket(node);
+    socket->SetAttribute("TsoMaxSegments", UintegerValue(m_tsoMaxSegments));
+    return socket;
+}
+
+Ptr<ErrorModel>
+TcpSegmentationOffloadTestCase::CreateReceiverErrorModel()
+{
+    Ptr<TcpSeqErrorModel> errorModel = CreateObject<TcpSeqErrorModel>();
+    if (m_dropSeq != 0)
+    {
+        errorModel->AddSeqToKill(SequenceNumber32(m_dropSeq));
+    }
+    return errorModel;
+}
+
+void
+TcpSegmentationOffloadTestCase::Tx(const Ptr<const Packet> p, const TcpHeader& h, SocketWho who)
+{
+    if (who == RECEIVER)
+    {
+        if (p->GetSize() == 0 && h.GetFlags() == TcpHeader::ACK)
+        {
+            m_receiverAcks++;
+        }
+        return;
+    }
+    if (p->GetSize() == 0)
+    {
+        return;
+    }
+
+    uint32_t segSize = GetSegSize(SENDER);
+    NS_TEST_ASSERT_MSG_LT_OR_EQ(p->GetSize(),
+                                m_tsoMaxSegments * segSize,
+                                "Super-segment larger than allowed");
+    if (h.GetSequenceNumber() < m_highestTx)
+    {
+        NS_TEST_ASSERT_MSG_LT_OR_EQ(p->GetSize(), segSize, "Retransmission larger than MSS");
+        m_retransmissions++;
+    }
+    else
+    {
+        if (p->GetSize() > segSize)
+        {
+            m_superSegments++;
+        }
+        m_highestTx = h.GetSequenceNumber() + p->GetSize();
+    }
+}
+
+void
+TcpSegmentationOffloadTestCase::Rx(const Ptr<const Packet> p, const TcpHeader& h, SocketWho who)
+{
+    if (who != RECEIVER || p->GetSize() == 0)
+    {
+        return;
+    }
+    if (h.GetSequenceNumber() == m_highestRx && p->GetSize() > GetSegSize(RECEIVER))
+    {
+        m_rxSuperSegments++;
+    }
+    m_highestRx = std::max(m_highestRx, h.GetSequenceNumber() + p->GetSize());
+}
+
+void
+TcpSegmentationOffloadTestCase::FinalChecks()
+{
+    uint32_t totalBytes = GetPktSize() * GetPktCount();
+    uint32_t totalSegments = totalBytes / GetSegSize(SENDER);
+
+    NS_TEST_ASSERT_MSG_EQ(m_highestRx,
+                          SequenceNumber32(1 + totalBytes),
+                          "Not all the data has been delivered");
+    if (m_tsoMaxSegments == 1)
+    {
+        NS_TEST_ASSERT_MSG_EQ(m_superSegments, 0, "Super-segments sent with TSO disabled");
+        return;
+    }
+
+    NS_TEST_ASSERT_MSG_GT(m_superSegments, 0, "No super-segment sent with TSO enabled");
+    if (m_dropSeq != 0)
+    {
+        NS_TEST_ASSERT_MSG_GT(m_retransmissions, 0, "The dropped data was not retransmitted");
+    }
+    else
+    {
+        NS_TEST_ASSERT_MSG_EQ(m_retransmissions, 0, "Unexpected retransmissions");
+    }
+    // Each super-segment is ACKed at once, and its segments share that single ACK
+    NS_TEST_ASSERT_MSG_GT_OR_EQ(m_receiverAcks,
+                                m_rxSuperSegments,
+                                "A super-segment has not been ACKed at once");
+    NS_TEST_ASSERT_MSG_LT(m_receiverAcks,
+                          totalSegments / 2,
+                          "ACKs of the segments of a super-segment were not coalesced");
+}
+
+/**
+ * @ingroup internet-test
+ *
+ * @brief Check that a router fragments the TSO super-segments that do not fit
+ * the MTU of the next hop, and that the fragments do not carry the
+ * SegmentationOffloadTag.
+ *
+ * Topology: sender -- (MTU 1500) -- router -- (MTU 400) -- receiver.
+ */
+class TcpSegmentationOffloadSmallMtuTestCase : public TestCase
+{
+  public:
+    TcpSegmentationOffloadSmallMtuTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * @brief Send the data once the connection is established.
+     * @param socket The sender socket.
+     */
+    void ConnectionSucceeded(Ptr<Socket> socket);
+    /**
+     * @brief Accept a connection and set its receive callback.
+     * @param socket The accepted socket.
+     * @param from The address of the peer.
+     */
+    void Accept(Ptr<Socket> socket, const Address& from);
+    /**
+     * @brief Receive data.
+     * @param socket The receiving socket.
+     */
+    void Receive(Ptr<Socket> socket);
+    /**
+     * @brief Check a packet enqueued on the small-MTU hop.
+     * @param p The packet.
+     */
+    void SmallMtuEnqueue(Ptr<const Packet> p);
+
+    uint32_t m_toSend{8000};     //!< Bytes to send
+    uint32_t m_received{0};      //!< Bytes received
+    uint32_t m_smallMtuTx{0};    //!< Packets sent on the small-MTU hop
+    uint32_t m_taggedPackets{0}; //!< Packets carrying the tag on the small-MTU hop
+    uint32_t m_oversized{0};     //!< Packets exceeding the MTU on the small-MTU hop
+};
+
+TcpSegmentationOffloadSmallMtuTestCase::TcpSegmentationOffloadSmallMtuTestCase()
+    : TestCase("TSO super-segments fragmented on a small-MTU hop")
+{
+}
+
+void
+TcpSegmentationOffloadSmallMtuTestCase::ConnectionSucceeded(Ptr<Socket> socket)
+{
+    socket->Send(Create<Packet>(m_toSend));
+    socket->Close();
+}
+
+void
+TcpSegmentationOffloadSmallMtuTestCase::Accept(Ptr<Socket> socket, const Address& from)
+{
+    socket->SetRecvCallback(MakeCallback(&TcpSegmentationOffloadSmallMtuTestCase::Receive, this));
+}
+
+void
+TcpSegmentationOffloadSmallMtuTestCase::Receive(Ptr<Socket> socket)
+{
+    Ptr<Packet> p;
+    while ((p = socket->Recv()))
+    {
+        SegmentationOffloadTag offloadTag;
+        NS_TEST_EXPECT_MSG_EQ(p->PeekPacketTag(offloadTag),
+                              false,
+                              "The tag has been handed to the application");
+        m_received += p->GetSize();
+    }
+}
+
+void
+TcpSegmentationOffloadSmallMtuTestCase::SmallMtuEnqueue(Ptr<const Packet> p)
+{
+    SegmentationOffloadTag offloadTag;
+    m_smallMtuTx++;
+    if (p->PeekPacketTag(offloadTag))
+    {
+        m_taggedPackets++;
+    }
+    if (p->GetSize() > 400)
+    {
+        m_oversized++;
+    }
+}
+
+void
+TcpSegmentationOffloadSmallMtuTestCase::DoRun()
+{
+    NodeContainer n;
+    n.Create(3);
+    NodeContainer n0n1(n.Get(0), n.Get(1));
+    NodeContainer n1n2(n.Get(1), n.Get(2));
+
+    SimpleNetDeviceHelper simpleHelper;
+    simpleHelper.SetNetDevicePointToPointMode(true);
+    NetDeviceContainer devices = simpleHelper.Install(n0n1, CreateObject<SimpleChannel>());
+    NetDeviceContainer devices2 = simpleHelper.Install(n1n2, CreateObject<SimpleChannel>());
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        DynamicCast<SimpleNetDevice>(devices.Get(i))->SetMtu(1500);
+        DynamicCast<SimpleNetDevice>(devices2.Get(i))->SetMtu(400);
+    }
+    DynamicCast<SimpleNetDevice>(devices2.Get(0))
+        ->GetQueue()
+        ->TraceConnectWithoutContext(
+            "Enqueue",
+            MakeCallback(&TcpSegmentationOffloadSmallMtuTestCase::SmallMtuEnqueue, this));
+
+    InternetStackHelper internet;
+    internet.Install(n);
+
+    Ipv4AddressHelper address;
+    address.SetBase("10.0.0.0", "255.255.255.0");
+    address.Assign(devices);
+    address.SetBase("10.0.1.0", "255.255.255.0");
+    Ipv4InterfaceContainer i2 = address.Assign(devices2);
+
+    Ipv4GlobalRoutingHelper::PopulateRoutingTables();
+
+    Ptr<Socket> server = Socket::CreateSocket(n.Get(2), TcpSocketFactory::GetTypeId());
+    server->Bind(InetSocketAddress(Ipv4Address::GetAny(), 4477));
+    server->Listen();
+    server->SetAcceptCallback(
+        MakeNullCallback<bool, Ptr<Socket>, const Address&>(),
+        MakeCallback(&TcpSegmentationOffloadSmallMtuTestCase::Accept, this));
+
+    Ptr<Socket> client = Socket::CreateSocket(n.Get(0), TcpSocketFactory::GetTypeId());
+    client->SetAttribute("SegmentSize", UintegerValue(500));
+    client->SetAttribute("TsoMaxSegments", UintegerValue(4));
+    client->SetConnectCallback(
+        MakeCallback(&TcpSegmentationOffloadSmallMtuTestCase::ConnectionSucceeded, this),
+        MakeNullCallback<void, Ptr<Socket>>());
+    client->Connect(InetSocketAddress(i2.GetAddress(1), 4477));
+
+    Simulator::Stop(Seconds(20));
+    Simulator::Run();
+
+    NS_TEST_EXPECT_MSG_EQ(m_received, m_toSend, "Not all the data has been delivered");
+    NS_TEST_EXPECT_MSG_GT(m_smallMtuTx, 0, "Nothing sent on the small-MTU hop");
+    NS_TEST_EXPECT_MSG_EQ(m_taggedPackets, 0, "Fragments carry the segmentation offload tag");
+    NS_TEST_EXPECT_MSG_EQ(m_oversized, 0, "Packets larger than the MTU on the small-MTU hop");
+
+    Simulator::Destroy();
+}
+
+/**
+ * @ingroup internet-test
+ *
+ * @brief TCP segmentation offload TestSuite
+ */
+class TcpSegmentationOffloadTestSuite : public TestSuite
+{
+  public:
+    TcpSegmentationOffloadTestSuite()
+        : TestSuite("tcp-segmentation-offload", Type::UNIT)
+    {
+        AddTestCase(new TcpSegmentationOffloadTestCase("TSO disabled", 1, 0),
+                    TestCase::Duration::QUICK);
+        AddTestCase(new TcpSegmentationOffloadTestCase("TSO, 4 segments", 4, 0),
+                    TestCase::Duration::QUICK);
+        AddTestCase(new TcpSegmentationOffloadTestCase("TSO, 4 segments, loss", 4, 2001),
+                    TestCase::Duration::QUICK);
+        AddTestCase(new TcpSegmentationOffloadSmallMtuTestCase, TestCase::Duration::QUICK);
+    }
+};
+
+static TcpSegmentationOffloadTestSuite
+    g_tcpSegmentationOffloadTestSuite; //!< Static variable for test initialization
@@ -42,6 +42,8 @@ class TcpTxBufferTestCase : public TestCase
     /** @brief Test the logic of merging items in GetTransmittedSegment()
      * which is triggered by CopyFromSequence()*/
     void TestMergeItemsWhenGetTransmittedSegment();
+    /** @brief Test the scoreboard with SACK blocks growing one segment at a time */
+    void TestIncrementalSack();
     /**
      * @brief Callback to provide a value of receiver window
      * @returns the receiver window size
@@ -89,6 +91,12 @@ TcpTxBufferTestCase::DoRun()
                         &TcpTxBufferTestCase::TestMergeItemsWhenGetTransmittedSegment,
                         this);
 
+    /*
+     * Case for the scoreboard: many holes, SACK blocks that grow one segment
+     * at a time and that are reported again in the following ACKs.
+     */
+    Simulator::Schedule(Seconds(0), &TcpTxBufferTestCase::TestIncrementalSack, this);
+
     Simulator::Run();
     Simulator::Destroy();
 }
@@ -409,6 +417,81 @@ TcpTxBufferTestCase::TestMergeItemsWhenGetTransmittedSegment()
     txBuf.CopyFromSequence(2000, SequenceNumber32(1));
 }
 
+void
+TcpTxBufferTestCase::TestIncrementalSack()
+{
+    Ptr<TcpTxBuffer> txBuf = CreateObject<TcpTxBuffer>();
+    txBuf->SetRWndCallback(MakeCallback(&TcpTxBufferTestCase::GetRWnd, this));
+    SequenceNumber32 head(1);
+    uint32_t segmentSize = 100;
+    uint32_t dupThresh = 3;
+    uint32_t segments = 100;
+    txBuf->SetSegmentSize(segmentSize);
+    txBuf->SetDupAckThresh(dupThresh);
+    txBuf->SetHeadSequence(head);
+    txBuf->Add(Create<Packet>(segments * segmentSize));
+    for (uint32_t i = 0; i < segments; ++i)
+    {
+        txBuf->CopyFromSequence(segmentSize, head + segmentSize * i);
+    }
+
+    // One segment every ten is lost; every ACK carries the block of the
+    // received segments that contains the last one, plus the two previous blocks
+    std::vector<bool> sacked(segments, false);
+    for (uint32_t i = 1; i < segments; ++i)
+    {
+        if (i % 10 == 0)
+        {
+            continue;
+        }
+        sacked[i] = true;
+        TcpOptionSack::SackList sackList;
+        uint32_t blockStart = (i / 10) * 10 + 1;
+        sackList.emplace_back(head + segmentSize * blockStart, head + segmentSize * (i + 1));
+        for (uint32_t b = 1; b < 3 && blockStart > 10 * b; ++b)
+        {
+            uint32_t start = blockStart - 10 * b;
+            sackList.emplace_back(head + segmentSize * start, head + segmentSize * (start + 9));
+        }
+        txBuf->Update(sackList);
+
+        // An un-SACKed segment is lost when there are at least dupThresh
+        // SACKed segments above it
+        uint32_t expectedSacked = 0;
+        uint32_t expectedLost = 0;
+        uint32_t sackedAbove = 0;
+        for (uint32_t j = segments; j-- > 0;)
+        {
+            if (sacked[j])
+            {
+                ++sackedAbove;
+                expectedSacked += segmentSize;
+            }
+            else if (sackedAbove >= dupThresh)
+            {
+                expectedLost += segmentSize;
+                NS_TEST_ASSERT_MSG_EQ(txBuf->IsLost(head + segmentSize * j),
+                                      true,
+                                      "Segment " << j << " should be lost after ACK " << i);
+            }
+        }
+        NS_TEST_ASSERT_MSG_EQ(txBuf->GetSacked(),
+                              expectedSacked,
+                              "Wrong SACKed bytes after ACK " << i);
+        NS_TEST_ASSERT_MSG_EQ(txBuf->GetLost(), expectedLost, "Wrong lost bytes after ACK " << i);
+    }
+
+    // Retransmit the first lost segment, and acknowledge it
+    txBuf->CopyFromSequence(segmentSize, head);
+    txBuf->DiscardUpTo(head + segmentSize * 10);
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetSacked(),
+                          (segments - 10 - (segments - 10) / 10) * segmentSize,
+                          "Wrong SACKed bytes after the cumulative ACK");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetLost(),
+                          ((segments - 10) / 10) * segmentSize,
+                          "Wrong lost bytes after the cumulative ACK");
+}
+
 void
 TcpTxBufferTestCase::TestTransmittedBlock()
 {
@@ -0,0 +1,185 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "mobility-grid-index.h"
+
+#include "ns3/assert.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("MobilityGridIndex");
+
+MobilityGridIndex::MobilityGridIndex(double cellSize)
+    : m_cellSize(cellSize),
+      m_lastRefresh(Simulator::Now())
+{
+    NS_LOG_FUNCTION(this << cellSize);
+    NS_ASSERT_MSG(cellSize > 0, "The cell size must be positive");
+}
+
+MobilityGridIndex::~MobilityGridIndex()
+{
+    NS_LOG_FUNCTION(this);
+    for (const auto& [mobility, ids] : m_itemsByMobility)
+    {
+        m_items[ids.front()].mobility->TraceDisconnectWithoutContext(
+            "CourseChange",
+            MakeCallback(&MobilityGridIndex::CourseChanged, this));
+    }
+}
+
+std::size_t
+MobilityGridIndex::Add(Ptr<MobilityModel> mobility)
+{
+    NS_LOG_FUNCTION(this << mobility);
+    const auto id = m_items.size();
+    if (!mobility)
+    {
+        m_items.push_back({nullptr, 0});
+        m_unpositioned.push_back(id);
+        return id;
+    }
+    const auto cell = GetCellKey(mobility->GetPosition());
+    m_items.push_back({mobility, cell});
+    m_cells[cell].push_back(id);
+    m_maxSpeed = std::max(m_maxSpeed, CalculateDistance(mobility->GetVelocity(), Vector()));
+
+    auto& ids = m_itemsByMobility[PeekPointer(mobility)];
+    if (ids.empty())
+    {
+        mobility->TraceConnectWithoutContext(
+            "CourseChange",
+            MakeCallback(&MobilityGridIndex::CourseChanged, this));
+    }
+    ids.push_back(id);
+    return id;
+}
+
+std::vector<std::size_t>
+MobilityGridIndex::GetItemsInRange(Ptr<const MobilityModel> center, double range)
+{
+    NS_LOG_FUNCTION(this << center << range);
+    auto slack = m_maxSpeed * (Simulator::Now() - m_lastRefresh).GetSeconds();
+    if (slack > m_cellSize / 2)
+    {
+        Refresh();
+        slack = 0;
+    }
+
+    std::vector<std::size_t> result(m_unpositioned);
+    auto addIfInRange = [&](const std::vector<std::size_t>& ids) {
+        for (auto id : ids)
+        {
+            if (m_items[id].mobility->GetDistanceFrom(center) <= range)
+            {
+                result.push_back(id);
+            }
+        }
+    };
+
+    const auto position = center->GetPosition();
+    const auto reach = range + slack;
+    const auto xMin = static_cast<int64_t>(std::floor((position.x - reach) / m_cellSize));
+    const auto xMax = static_cast<int64_t>(std::floor((position.x + reach) / m_cellSize));
+    const auto yMin = static_cast<int64_t>(std::floor((position.y - reach) / m_cellSize));
+    const auto yMax = static_cast<int64_t>(std::floor((position.y + reach) / m_cellSize));
+
+    if (static_cast<double>(xMax - xMin + 1) * (yMax - yMin + 1) > m_cells.size())
+    {
+        // the search area covers more cells than there are occupied ones
+        for (const auto& [cell, ids] : m_cells)
+        {
+            addIfInRange(ids);
+        }
+    }
+    else
+    {
+        for (auto cx = xMin; cx <= xMax; ++cx)
+        {
+            for (auto cy = yMin; cy <= yMax; ++cy)
+            {
+                if (auto it = m_cells.find(GetCellKey(cx, cy)); it != m_cells.end())
+                {
+                    addIfInRange(it->second);
+                }
+            }
+        }
+    }
+
+    std::sort(result.begin(), result.end());
+    NS_LOG_DEBUG(result.size() << " out of " << m_items.size() << " items in range");
+    return result;
+}
+
+uint64_t
+MobilityGridIndex::GetCellKey(const Vector& position) const
+{
+    return GetCellKey(static_cast<int64_t>(std::floor(position.x / m_cellSize)),
+                      static_cast<int64_t>(std::floor(position.y / m_cellSize)));
+}
+
+uint64_t
+MobilityGridIndex::GetCellKey(int64_t cx, int64_t cy)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32) | static_cast<uint32_t>(cy);
+}
+
+void
+MobilityGridIndex::Update(std::size_t id)
+{
+    auto& item = m_items[id];
+    const auto cell = GetCellKey(item.mobility->GetPosition());
+    if (cell == item.cell)
+    {
+        return;
+    }
+    auto it = m_cells.find(item.cell);
+    NS_ASSERT(it != m_cells.end());
+    auto& ids = it->second;
+    *std::find(ids.begin(), ids.end(), id) = ids.back();
+    ids.pop_back();
+    if (ids.empty())
+    {
+        m_cells.erase(it);
+    }
+    m_cells[cell].push_back(id);
+    item.cell = cell;
+}
+
+void
+MobilityGridIndex::Refresh()
+{
+    NS_LOG_FUNCTION(this);
+    m_maxSpeed = 0;
+    for (const auto& [mobility, ids] : m_itemsByMobility)
+    {
+        for (auto id : ids)
+        {
+            Update(id);
+        }
+        m_maxSpeed = std::max(m_maxSpeed, CalculateDistance(mobility->GetVelocity(), Vector()));
+    }
+    m_lastRefresh = Simulator::Now();
+}
+
+void
+MobilityGridIndex::CourseChanged(Ptr<const MobilityModel> mobility)
+{
+    NS_LOG_FUNCTION(this << mobility);
+    auto it = m_itemsByMobility.find(PeekPointer(mobility));
+    NS_ASSERT(it != m_itemsByMobility.end());
+    for (auto id : it->second)
+    {
+        Update(id);
+    }
+    m_maxSpeed = std::max(m_maxSpeed, CalculateDistance(mobility->GetVelocity(), Vector()));
+}
+
+} // namespace ns3
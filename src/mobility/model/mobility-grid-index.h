@@ -0,0 +1,120 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef MOBILITY_GRID_INDEX_H
+#define MOBILITY_GRID_INDEX_H
+
+#include "mobility-model.h"
+
+#include "ns3/nstime.h"
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+#include "ns3/vector.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup mobility
+ *
+ * @brief Uniform 2D grid over a set of mobility models, used to find the items
+ * that are within a given distance of a point without visiting every item.
+ *
+ * Items are identified by the consecutive indices returned by Add. Each item is
+ * bucketed in the cell of its position at the time it was last refreshed. The
+ * index follows the CourseChange trace of the mobility models, so that items
+ * that jump or change their velocity are moved to their new cell right away; in
+ * between, the query radius is extended by the distance that the fastest item
+ * may have covered since the last full refresh, and the index is refreshed
+ * once this slack exceeds half a cell. This requires that mobility models
+ * notify a course change whenever their velocity changes, which all the models
+ * with piecewise constant velocity do (but ConstantAccelerationMobilityModel
+ * does not).
+ *
+ * The result of a query is exact: candidates are filtered on their actual
+ * distance, and items without a mobility model are always returned.
+ */
+class MobilityGridIndex : public SimpleRefCount<MobilityGridIndex>
+{
+  public:
+    /**
+     * Create an empty index
+     * @param cellSize the side of the grid cells, in meters
+     */
+    MobilityGridIndex(double cellSize);
+    ~MobilityGridIndex();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    MobilityGridIndex(const MobilityGridIndex&) = delete;
+    MobilityGridIndex& operator=(const MobilityGridIndex&) = delete;
+
+    /**
+     * Add an item to the index
+     * @param mobility the mobility model of the item, possibly null
+     * @return the identifier of the item, i.e., the number of items added before it
+     */
+    std::size_t Add(Ptr<MobilityModel> mobility);
+
+    /**
+     * Get the items that are within a given distance of a mobility model
+     * @param center the mobility model at the center of the search
+     * @param range the maximum distance, in meters
+     * @return the identifiers of the items in range, in increasing order
+     */
+    std::vector<std::size_t> GetItemsInRange(Ptr<const MobilityModel> center, double range);
+
+  private:
+    /// An item of the index
+    struct Item
+    {
+        Ptr<MobilityModel> mobility; //!< the mobility model of the item
+        uint64_t cell;               //!< the key of the cell where the item is bucketed
+    };
+
+    /**
+     * @param position a position
+     * @return the key of the cell containing the given position
+     */
+    uint64_t GetCellKey(const Vector& position) const;
+
+    /**
+     * @param cx the index of a cell along the x axis
+     * @param cy the index of a cell along the y axis
+     * @return the key of the given cell
+     */
+    static uint64_t GetCellKey(int64_t cx, int64_t cy);
+
+    /**
+     * Move an item to the cell of its current position
+     * @param id the identifier of the item
+     */
+    void Update(std::size_t id);
+
+    /**
+     * Move all the items to the cell of their current position and reset the slack
+     */
+    void Refresh();
+
+    /**
+     * Callback for the CourseChange trace of the indexed mobility models
+     * @param mobility the mobility model whose course changed
+     */
+    void CourseChanged(Ptr<const MobilityModel> mobility);
+
+    double m_cellSize;                       //!< the side of the cells
+    std::vector<Item> m_items;               //!< the items, by identifier
+    std::vector<std::size_t> m_unpositioned; //!< the items without mobility model
+    std::unordered_map<uint64_t, std::vector<std::size_t>> m_cells; //!< the items in each cell
+    std::unordered_map<const MobilityModel*, std::vector<std::size_t>>
+        m_itemsByMobility; //!< the items sharing each mobility model
+    Time m_lastRefresh;    //!< the time of the last full refresh
+    double m_maxSpeed{0};  //!< upper bound on the speed of the items since the last refresh
+};
+
+} // namespace ns3
+
+#endif /* MOBILITY_GRID_INDEX_H */
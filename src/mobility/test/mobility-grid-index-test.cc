@@ -0,0 +1,150 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/mobility-grid-index.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/node-container.h"
+#include "ns3/position-allocator.h"
+#include "ns3/rectangle.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+/**
+ * @ingroup mobility-test
+ *
+ * @brief Check that the items returned by a MobilityGridIndex are exactly those
+ * found by visiting every item, while nodes move around and change course.
+ */
+class MobilityGridIndexTestCase : public TestCase
+{
+  public:
+    MobilityGridIndexTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Compare the result of the index with a linear search from every item
+     * @param range the search range
+     */
+    void Check(double range);
+
+    std::vector<Ptr<MobilityModel>> m_mobilities; //!< the mobility models of the items
+    Ptr<MobilityGridIndex> m_index;               //!< the index under test
+    uint32_t m_checks{0};                         //!< the number of searches performed
+};
+
+MobilityGridIndexTestCase::MobilityGridIndexTestCase()
+    : TestCase("Check the grid index against a linear search")
+{
+}
+
+void
+MobilityGridIndexTestCase::Check(double range)
+{
+    for (const auto& center : m_mobilities)
+    {
+        if (!center)
+        {
+            continue;
+        }
+        std::vector<std::size_t> expected;
+        for (std::size_t id = 0; id < m_mobilities.size(); ++id)
+        {
+            if (!m_mobilities[id] || m_mobilities[id]->GetDistanceFrom(center) <= range)
+            {
+                expected.push_back(id);
+            }
+        }
+        NS_TEST_ASSERT_MSG_EQ((m_index->GetItemsInRange(center, range) == expected),
+                              true,
+                              "Unexpected items in range at " << Simulator::Now().As(Time::S));
+        ++m_checks;
+    }
+}
+
+void
+MobilityGridIndexTestCase::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    NodeContainer walkers(25);
+    NodeContainer fixed(5);
+    MobilityHelper mobility;
+    mobility.SetPositionAllocator("ns3::RandomRectanglePositionAllocator",
+                                  "X",
+                                  StringValue("ns3::UniformRandomVariable[Min=-200|Max=200]"),
+                                  "Y",
+                                  StringValue("ns3::UniformRandomVariable[Min=-200|Max=200]"));
+    mobility.SetMobilityModel("ns3::RandomWalk2dMobilityModel",
+                              "Bounds",
+                              RectangleValue(Rectangle(-200, 200, -200, 200)),
+                              "Speed",
+                              StringValue("ns3::ConstantRandomVariable[Constant=20]"),
+                              "Time",
+                              TimeValue(Seconds(0.5)),
+                              "Mode",
+                              StringValue("Time"));
+    mobility.Install(walkers);
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(fixed);
+    NodeContainer nodes(walkers, fixed);
+
+    m_index = Create<MobilityGridIndex>(50);
+    for (uint32_t i = 0; i < nodes.GetN(); ++i)
+    {
+        m_mobilities.push_back(nodes.Get(i)->GetObject<MobilityModel>());
+        NS_TEST_ASSERT_MSG_EQ(m_index->Add(m_mobilities.back()), m_mobilities.size() - 1, "");
+        if (i % 10 == 0)
+        {
+            // items without mobility, and items sharing a mobility model
+            m_mobilities.push_back(nullptr);
+            m_index->Add(nullptr);
+            m_mobilities.push_back(m_mobilities[m_mobilities.size() - 2]);
+            m_index->Add(m_mobilities.back());
+        }
+    }
+
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        Simulator::Schedule(MilliSeconds(73 * i), &MobilityGridIndexTestCase::Check, this, 50);
+        Simulator::Schedule(MilliSeconds(73 * i), &MobilityGridIndexTestCase::Check, this, 120);
+    }
+    // a node jumping across the area
+    Simulator::Schedule(Seconds(3), [&]() {
+        m_mobilities[m_mobilities.size() - 1]->SetPosition(Vector(190, -190, 0));
+    });
+    Simulator::Stop(Seconds(8));
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_EQ(m_checks, 200 * 33, "Unexpected number of checks");
+
+    m_index = nullptr;
+    m_mobilities.clear();
+    Simulator::Destroy();
+}
+
+/**
+ * @ingroup mobility-test
+ *
+ * @brief MobilityGridIndex test suite
+ */
+class MobilityGridIndexTestSuite : public TestSuite
+{
+  public:
+    MobilityGridIndexTestSuite();
+};
+
+MobilityGridIndexTestSuite::MobilityGridIndexTestSuite()
+    : TestSuite("mobility-grid-index", Type::UNIT)
+{
+    AddTestCase(new MobilityGridIndexTestCase, TestCase::Duration::QUICK);
+}
+
+static MobilityGridIndexTestSuite g_mobilityGridIndexTestSuite; ///< the test suite
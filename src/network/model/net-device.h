@@ -356,6 +356,15 @@ class NetDevice : public Object
      * @return true if this interface supports a bridging mode, false otherwise.
      */
     virtual bool SupportsSendFrom() const = 0;
+
+    /**
+     * A device supporting segmentation offload accepts packets carrying a
+     * SegmentationOffloadTag whose segments (but not the whole packet) fit the
+     * MTU, and puts on the wire the segments the packet stands for.
+     *
+     * @return true if this interface supports segmentation offload, false otherwise.
+     */
+    virtual bool SupportsSegmentationOffload() const;
 };
 
 } // namespace ns3
@@ -0,0 +1,122 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#include "segmentation-offload-tag.h"
+
+#include "ns3/log.h"
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("SegmentationOffloadTag");
+
+NS_OBJECT_ENSURE_REGISTERED(SegmentationOffloadTag);
+
+TypeId
+SegmentationOffloadTag::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::SegmentationOffloadTag")
+                            .SetParent<Tag>()
+                            .SetGroupName("Network")
+                            .AddConstructor<SegmentationOffloadTag>();
+    return tid;
+}
+
+TypeId
+SegmentationOffloadTag::GetInstanceTypeId() const
+{
+    return GetTypeId();
+}
+
+uint32_t
+SegmentationOffloadTag::GetSerializedSize() const
+{
+    return 6;
+}
+
+void
+SegmentationOffloadTag::Serialize(TagBuffer buf) const
+{
+    buf.WriteU16(m_segments);
+    buf.WriteU32(m_payloadSize);
+}
+
+void
+SegmentationOffloadTag::Deserialize(TagBuffer buf)
+{
+    m_segments = buf.ReadU16();
+    m_payloadSize = buf.ReadU32();
+}
+
+void
+SegmentationOffloadTag::Print(std::ostream& os) const
+{
+    os << "Segments=" << m_segments << " PayloadSize=" << m_payloadSize;
+}
+
+SegmentationOffloadTag::SegmentationOffloadTag()
+    : Tag()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+SegmentationOffloadTag::SegmentationOffloadTag(uint16_t segments, uint32_t payloadSize)
+    : Tag(),
+      m_segments(segments),
+      m_payloadSize(payloadSize)
+{
+    NS_LOG_FUNCTION(this << segments << payloadSize);
+    NS_ASSERT_MSG(segments > 0, "A packet carries at least one segment");
+}
+
+void
+SegmentationOffloadTag::SetSegments(uint16_t segments)
+{
+    NS_LOG_FUNCTION(this << segments);
+    NS_ASSERT_MSG(segments > 0, "A packet carries at least one segment");
+    m_segments = segments;
+}
+
+uint16_t
+SegmentationOffloadTag::GetSegments() const
+{
+    return m_segments;
+}
+
+void
+SegmentationOffloadTag::SetPayloadSize(uint32_t payloadSize)
+{
+    NS_LOG_FUNCTION(this << payloadSize);
+    m_payloadSize = payloadSize;
+}
+
+uint32_t
+SegmentationOffloadTag::GetPayloadSize() const
+{
+    return m_payloadSize;
+}
+
+uint32_t
+SegmentationOffloadTag::GetSegmentSize(uint32_t packetSize) const
+{
+    if (packetSize < m_payloadSize)
+    {
+        // The tag does not describe this packet (e.g., a fragment of a super-segment)
+        return packetSize;
+    }
+    uint32_t headerSize = packetSize - m_payloadSize;
+    return headerSize + (m_payloadSize + m_segments - 1) / m_segments;
+}
+
+uint32_t
+SegmentationOffloadTag::GetWireSize(uint32_t packetSize) const
+{
+    if (packetSize < m_payloadSize)
+    {
+        return packetSize;
+    }
+    uint32_t headerSize = packetSize - m_payloadSize;
+    return packetSize + (m_segments - 1) * headerSize;
+}
+
+} // namespace ns3
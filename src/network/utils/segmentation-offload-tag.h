@@ -0,0 +1,101 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef SEGMENTATION_OFFLOAD_TAG_H
+#define SEGMENTATION_OFFLOAD_TAG_H
+
+#include "ns3/tag.h"
+
+namespace ns3
+{
+
+/**
+ * @ingroup network
+ *
+ * @brief Packet tag marking a segmentation offload (TSO) super-segment.
+ *
+ * A transport protocol emulating segmentation offload may hand a single
+ * packet carrying several segments worth of payload to the lower layers.
+ * This tag records how many segments the packet stands for, and how many
+ * bytes of payload it carries, so that the layers below can reason about the
+ * segments that would be on the wire: the network layer does not fragment a
+ * super-segment whose segments fit the MTU, and a device may account for the
+ * headers of every segment when computing the transmission time.
+ *
+ * The headers found in front of the payload (e.g., transport, network and
+ * link layer headers) are assumed to be repeated in every segment.
+ *
+ * Only devices returning true from NetDevice::SupportsSegmentationOffload ()
+ * (currently PointToPointNetDevice and SimpleNetDevice) receive super-segments;
+ * on the other devices the network layer fragments them as usual, and the
+ * fragments do not carry the tag. A super-segment is queued, dropped and
+ * corrupted as a whole.
+ */
+class SegmentationOffloadTag : public Tag
+{
+  public:
+    /**
+     * @brief Get the type ID.
+     * @return the object TypeId
+     */
+    static TypeId GetTypeId();
+    TypeId GetInstanceTypeId() const override;
+    uint32_t GetSerializedSize() const override;
+    void Serialize(TagBuffer buf) const override;
+    void Deserialize(TagBuffer buf) override;
+    void Print(std::ostream& os) const override;
+    SegmentationOffloadTag();
+
+    /**
+     * Constructs a SegmentationOffloadTag
+     *
+     * @param segments the number of segments carried by the packet
+     * @param payloadSize the payload size of the packet, in bytes
+     */
+    SegmentationOffloadTag(uint16_t segments, uint32_t payloadSize);
+
+    /**
+     * Set the number of segments carried by the packet
+     * @param segments the number of segments
+     */
+    void SetSegments(uint16_t segments);
+    /**
+     * Get the number of segments carried by the packet
+     * @return the number of segments
+     */
+    uint16_t GetSegments() const;
+    /**
+     * Set the payload size, i.e., the size of the packet without the headers
+     * that are repeated in every segment
+     * @param payloadSize the payload size, in bytes
+     */
+    void SetPayloadSize(uint32_t payloadSize);
+    /**
+     * Get the payload size
+     * @return the payload size, in bytes
+     */
+    uint32_t GetPayloadSize() const;
+
+    /**
+     * Get the size of the largest segment on the wire, given the current size
+     * of the packet.
+     * @param packetSize the size of the packet, headers included
+     * @return the size of the largest segment, headers included
+     */
+    uint32_t GetSegmentSize(uint32_t packetSize) const;
+    /**
+     * Get the number of bytes on the wire for all the segments, given the
+     * current size of the packet.
+     * @param packetSize the size of the packet, headers included
+     * @return the total size of the segments, headers included
+     */
+    uint32_t GetWireSize(uint32_t packetSize) const;
+
+  private:
+    uint16_t m_segments{1};    //!< Number of segments
+    uint32_t m_payloadSize{0}; //!< Payload size (bytes)
+};
+
+} // namespace ns3
+
+#endif /* SEGMENTATION_OFFLOAD_TAG_H */
@@ -9,6 +9,7 @@
 
 #include "error-model.h"
 #include "queue.h"
+#include "segmentation-offload-tag.h"
 #include "simple-channel.h"
 
 #include "ns3/boolean.h"
@@ -422,7 +423,14 @@ SimpleNetDevice::SendFrom(Ptr<Packet> p,
                           uint16_t protocolNumber)
 {
     NS_LOG_FUNCTION(this << p << source << dest << protocolNumber);
-    if (p->GetSize() > GetMtu())
+    // A TSO super-segment is accepted as long as each of its segments fits the MTU
+    uint32_t size = p->GetSize();
+    SegmentationOffloadTag offloadTag;
+    if (p->PeekPacketTag(offloadTag))
+    {
+        size = offloadTag.GetSegmentSize(size);
+    }
+    if (size > GetMtu())
     {
         return false;
     }
@@ -474,7 +482,13 @@ SimpleNetDevice::StartTransmission()
     Time txTime = Time(0);
     if (m_bps > DataRate(0))
     {
-        txTime = m_bps.CalculateBytesTxTime(packet->GetSize());
+        uint32_t wireSize = packet->GetSize();
+        SegmentationOffloadTag offloadTag;
+        if (packet->PeekPacketTag(offloadTag))
+        {
+            wireSize = offloadTag.GetWireSize(wireSize);
+        }
+        txTime = m_bps.CalculateBytesTxTime(wireSize);
     }
     FinishTransmissionEvent =
         Simulator::Schedule(txTime, &SimpleNetDevice::FinishTransmission, this, packet);
@@ -554,4 +568,10 @@ SimpleNetDevice::SupportsSendFrom() const
     return true;
 }
 
+bool
+SimpleNetDevice::SupportsSegmentationOffload() const
+{
+    return true;
+}
+
 } // namespace ns3
@@ -126,6 +126,7 @@ class SimpleNetDevice : public NetDevice
 
     void SetPromiscReceiveCallback(PromiscReceiveCallback cb) override;
     bool SupportsSendFrom() const override;
+    bool SupportsSegmentationOffload() const override;
 
   protected:
     void DoDispose() override;
@@ -15,6 +15,7 @@
 #include "ns3/mac48-address.h"
 #include "ns3/pointer.h"
 #include "ns3/queue.h"
+#include "ns3/segmentation-offload-tag.h"
 #include "ns3/simulator.h"
 #include "ns3/trace-source-accessor.h"
 #include "ns3/uinteger.h"
@@ -238,7 +239,15 @@ PointToPointNetDevice::TransmitStart(Ptr<Packet> p)
     m_currentPkt = p;
     m_phyTxBeginTrace(m_currentPkt);
 
-    Time txTime = m_bps.CalculateBytesTxTime(p->GetSize());
+    // A TSO super-segment occupies the link as long as all the segments it stands
+    // for, each one with its own headers
+    uint32_t wireSize = p->GetSize();
+    SegmentationOffloadTag offloadTag;
+    if (p->PeekPacketTag(offloadTag))
+    {
+        wireSize = offloadTag.GetWireSize(wireSize);
+    }
+    Time txTime = m_bps.CalculateBytesTxTime(wireSize);
     Time txCompleteTime = txTime + m_tInterframeGap;
 
     NS_LOG_LOGIC("Schedule TransmitCompleteEvent in " << txCompleteTime.As(Time::S));
@@ -597,6 +606,12 @@ PointToPointNetDevice::SupportsSendFrom() const
     return false;
 }
 
+bool
+PointToPointNetDevice::SupportsSegmentationOffload() const
+{
+    return true;
+}
+
 void
 PointToPointNetDevice::DoMpiReceive(Ptr<Packet> p)
 {
@@ -139,7 +139,12 @@ Cost231PropagationLossModel::GetSSAntennaHeight() const
 double
 Cost231PropagationLossModel::GetLoss(Ptr<MobilityModel> a, Ptr<MobilityModel> b) const
 {
-    double distance = a->GetDistanceFrom(b);
+    return GetLossAtDistance(a->GetDistanceFrom(b));
+}
+
+double
+Cost231PropagationLossModel::GetLossAtDistance(double distance) const
+{
     if (distance <= m_minDistance)
     {
         return 0.0;
@@ -172,6 +177,19 @@ Cost231PropagationLossModel::DoCalcRxPower(double txPowerDbm,
     return txPowerDbm + GetLoss(a, b);
 }
 
+void
+Cost231PropagationLossModel::DoCalcRxPowerBatch(Ptr<MobilityModel> a,
+                                                const std::vector<Ptr<MobilityModel>>& b,
+                                                std::vector<double>& powerDbm) const
+{
+    const auto positions = GetPositions(b);
+    const auto position = a->GetPosition();
+    for (std::size_t i = 0; i < positions.size(); ++i)
+    {
+        powerDbm[i] += GetLossAtDistance(CalculateDistance(position, positions[i]));
+    }
+}
+
 int64_t
 Cost231PropagationLossModel::DoAssignStreams(int64_t stream)
 {
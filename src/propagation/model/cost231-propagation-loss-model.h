@@ -121,8 +121,18 @@ class Cost231PropagationLossModel : public PropagationLossModel
     double DoCalcRxPower(double txPowerDbm,
                          Ptr<MobilityModel> a,
                          Ptr<MobilityModel> b) const override;
+    void DoCalcRxPowerBatch(Ptr<MobilityModel> a,
+                            const std::vector<Ptr<MobilityModel>>& b,
+                            std::vector<double>& powerDbm) const override;
     int64_t DoAssignStreams(int64_t stream) override;
 
+    /**
+     * Get the propagation loss
+     * @param distance the distance between the source and the destination [m]
+     * @returns the propagation loss (in dBm)
+     */
+    double GetLossAtDistance(double distance) const;
+
     double m_BSAntennaHeight; //!< BS Antenna Height [m]
     double m_SSAntennaHeight; //!< SS Antenna Height [m]
     double m_lambda;          //!< The wavelength
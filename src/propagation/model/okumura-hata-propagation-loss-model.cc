@@ -68,16 +68,19 @@ OkumuraHataPropagationLossModel::~OkumuraHataPropagationLossModel()
 
 double
 OkumuraHataPropagationLossModel::GetLoss(Ptr<MobilityModel> a, Ptr<MobilityModel> b) const
+{
+    return GetLoss(a->GetPosition(), b->GetPosition());
+}
+
+double
+OkumuraHataPropagationLossModel::GetLoss(const Vector& aPosition, const Vector& bPosition) const
 {
     double loss = 0.0;
     double fmhz = m_frequency / 1e6;
     double log_fMhz = std::log10(fmhz);
     // In the Okumura Hata literature, the distance is expressed in units of kilometers
     // but other lengths are expressed in meters
-    double distKm = a->GetDistanceFrom(b) / 1000.0;
-
-    Vector aPosition = a->GetPosition();
-    Vector bPosition = b->GetPosition();
+    double distKm = CalculateDistance(aPosition, bPosition) / 1000.0;
 
     double hb = std::max(aPosition.z, bPosition.z);
     double hm = std::min(aPosition.z, bPosition.z);
@@ -154,6 +157,19 @@ OkumuraHataPropagationLossModel::DoCalcRxPower(double txPowerDbm,
     return (txPowerDbm - GetLoss(a, b));
 }
 
+void
+OkumuraHataPropagationLossModel::DoCalcRxPowerBatch(Ptr<MobilityModel> a,
+                                                    const std::vector<Ptr<MobilityModel>>& b,
+                                                    std::vector<double>& powerDbm) const
+{
+    const auto positions = GetPositions(b);
+    const auto position = a->GetPosition();
+    for (std::size_t i = 0; i < positions.size(); ++i)
+    {
+        powerDbm[i] -= GetLoss(position, positions[i]);
+    }
+}
+
 int64_t
 OkumuraHataPropagationLossModel::DoAssignStreams(int64_t stream)
 {
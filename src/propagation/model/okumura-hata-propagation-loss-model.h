@@ -57,8 +57,18 @@ class OkumuraHataPropagationLossModel : public PropagationLossModel
     double DoCalcRxPower(double txPowerDbm,
                          Ptr<MobilityModel> a,
                          Ptr<MobilityModel> b) const override;
+    void DoCalcRxPowerBatch(Ptr<MobilityModel> a,
+                            const std::vector<Ptr<MobilityModel>>& b,
+                            std::vector<double>& powerDbm) const override;
     int64_t DoAssignStreams(int64_t stream) override;
 
+    /**
+     * @param a the position of the source
+     * @param b the position of the destination
+     * @return the propagation loss (in dB)
+     */
+    double GetLoss(const Vector& a, const Vector& b) const;
+
     EnvironmentType m_environment; //!< Environment Scenario
     CitySize m_citySize;           //!< Size of the city
     double m_frequency;            //!< frequency in Hz
@@ -71,6 +71,42 @@ PropagationLossModel::CalcRxPower(double txPowerDbm,
     return self;
 }
 
+void
+PropagationLossModel::CalcRxPowerBatch(double txPowerDbm,
+                                       Ptr<MobilityModel> a,
+                                       const std::vector<Ptr<MobilityModel>>& b,
+                                       std::vector<double>& rxPowerDbm) const
+{
+    rxPowerDbm.assign(b.size(), txPowerDbm);
+    for (auto model = this; model != nullptr; model = PeekPointer(model->m_next))
+    {
+        model->DoCalcRxPowerBatch(a, b, rxPowerDbm);
+    }
+}
+
+void
+PropagationLossModel::DoCalcRxPowerBatch(Ptr<MobilityModel> a,
+                                         const std::vector<Ptr<MobilityModel>>& b,
+                                         std::vector<double>& powerDbm) const
+{
+    for (std::size_t i = 0; i < b.size(); ++i)
+    {
+        powerDbm[i] = DoCalcRxPower(powerDbm[i], a, b[i]);
+    }
+}
+
+std::vector<Vector>
+PropagationLossModel::GetPositions(const std::vector<Ptr<MobilityModel>>& b)
+{
+    std::vector<Vector> positions;
+    positions.reserve(b.size());
+    for (const auto& mobility : b)
+    {
+        positions.push_back(mobility->GetPosition());
+    }
+    return positions;
+}
+
 int64_t
 PropagationLossModel::AssignStreams(int64_t stream)
 {
@@ -255,7 +291,25 @@ FriisPropagationLossModel::DoCalcRxPower(double txPowerDbm,
      * L: system loss (unit-less)
      * lambda: wavelength (m)
      */
-    double distance = a->GetDistanceFrom(b);
+    return CalcRxPowerAtDistance(txPowerDbm, a->GetDistanceFrom(b));
+}
+
+void
+FriisPropagationLossModel::DoCalcRxPowerBatch(Ptr<MobilityModel> a,
+                                              const std::vector<Ptr<MobilityModel>>& b,
+                                              std::vector<double>& powerDbm) const
+{
+    const auto positions = GetPositions(b);
+    const auto position = a->GetPosition();
+    for (std::size_t i = 0; i < positions.size(); ++i)
+    {
+        powerDbm[i] = CalcRxPowerAtDistance(powerDbm[i], CalculateDistance(position, positions[i]));
+    }
+}
+
+double
+FriisPropagationLossModel::CalcRxPowerAtDistance(double txPowerDbm, double distance) const
+{
     if (distance < 3 * m_lambda)
     {
         NS_LOG_WARN(
@@ -413,15 +467,36 @@ TwoRayGroundPropagationLossModel::DoCalcRxPower(double txPowerDbm,
      * rx = tx + 10 log10 (-----------------------)
      *                      (d * d * d * d) * L
      */
-    double distance = a->GetDistanceFrom(b);
+    return CalcRxPowerAtPositions(txPowerDbm, a->GetPosition(), b->GetPosition());
+}
+
+void
+TwoRayGroundPropagationLossModel::DoCalcRxPowerBatch(Ptr<MobilityModel> a,
+                                                     const std::vector<Ptr<MobilityModel>>& b,
+                                                     std::vector<double>& powerDbm) const
+{
+    const auto positions = GetPositions(b);
+    const auto position = a->GetPosition();
+    for (std::size_t i = 0; i < positions.size(); ++i)
+    {
+        powerDbm[i] = CalcRxPowerAtPositions(powerDbm[i], position, positions[i]);
+    }
+}
+
+double
+TwoRayGroundPropagationLossModel::CalcRxPowerAtPositions(double txPowerDbm,
+                                                         const Vector& a,
+                                                         const Vector& b) const
+{
+    double distance = CalculateDistance(a, b);
     if (distance <= m_minDistance)
     {
         return txPowerDbm;
     }
 
     // Set the height of the Tx and Rx antennae
-    double txAntHeight = a->GetPosition().z + m_heightAboveZ;
-    double rxAntHeight = b->GetPosition().z + m_heightAboveZ;
+    double txAntHeight = a.z + m_heightAboveZ;
+    double rxAntHeight = b.z + m_heightAboveZ;
 
     // Calculate a crossover distance, under which we use Friis
     /*
@@ -520,7 +595,25 @@ LogDistancePropagationLossModel::DoCalcRxPower(double txPowerDbm,
                                                Ptr<MobilityModel> a,
                                                Ptr<MobilityModel> b) const
 {
-    double distance = a->GetDistanceFrom(b);
+    return CalcRxPowerAtDistance(txPowerDbm, a->GetDistanceFrom(b));
+}
+
+void
+LogDistancePropagationLossModel::DoCalcRxPowerBatch(Ptr<MobilityModel> a,
+                                                    const std::vector<Ptr<MobilityModel>>& b,
+                                                    std::vector<double>& powerDbm) const
+{
+    const auto positions = GetPositions(b);
+    const auto position = a->GetPosition();
+    for (std::size_t i = 0; i < positions.size(); ++i)
+    {
+        powerDbm[i] = CalcRxPowerAtDistance(powerDbm[i], CalculateDistance(position, positions[i]));
+    }
+}
+
+double
+LogDistancePropagationLossModel::CalcRxPowerAtDistance(double txPowerDbm, double distance) const
+{
     if (distance <= m_referenceDistance)
     {
         NS_LOG_DEBUG("distance=" << distance << "m, reference-attenuation=" << -m_referenceLoss
@@ -615,7 +708,26 @@ ThreeLogDistancePropagationLossModel::DoCalcRxPower(double txPowerDbm,
                                                     Ptr<MobilityModel> a,
                                                     Ptr<MobilityModel> b) const
 {
-    double distance = a->GetDistanceFrom(b);
+    return CalcRxPowerAtDistance(txPowerDbm, a->GetDistanceFrom(b));
+}
+
+void
+ThreeLogDistancePropagationLossModel::DoCalcRxPowerBatch(Ptr<MobilityModel> a,
+                                                         const std::vector<Ptr<MobilityModel>>& b,
+                                                         std::vector<double>& powerDbm) const
+{
+    const auto positions = GetPositions(b);
+    const auto position = a->GetPosition();
+    for (std::size_t i = 0; i < positions.size(); ++i)
+    {
+        powerDbm[i] = CalcRxPowerAtDistance(powerDbm[i], CalculateDistance(position, positions[i]));
+    }
+}
+
+double
+ThreeLogDistancePropagationLossModel::CalcRxPowerAtDistance(double txPowerDbm,
+                                                            double distance) const
+{
     NS_ASSERT(distance >= 0);
 
     // See doxygen comments for the formula and explanation
@@ -15,8 +15,10 @@
 
 #include "ns3/object.h"
 #include "ns3/random-variable-stream.h"
+#include "ns3/vector.h"
 
 #include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -90,6 +92,25 @@ class PropagationLossModel : public Object
      */
     double CalcRxPower(double txPowerDbm, Ptr<MobilityModel> a, Ptr<MobilityModel> b) const;
 
+    /**
+     * Returns the Rx Power at several destinations taking into account all
+     * the PropagationLossModel(s) chained to the current one.
+     *
+     * The result is the same as calling CalcRxPower for each destination in
+     * turn, but each model in the chain processes all the destinations at
+     * once, which allows it to hoist the computations that only depend on
+     * the source out of the per-destination loop.
+     *
+     * @param txPowerDbm current transmission power (in dBm)
+     * @param a the mobility model of the source
+     * @param b the mobility models of the destinations
+     * @param rxPowerDbm the reception power (in dBm) at each destination
+     */
+    void CalcRxPowerBatch(double txPowerDbm,
+                          Ptr<MobilityModel> a,
+                          const std::vector<Ptr<MobilityModel>>& b,
+                          std::vector<double>& rxPowerDbm) const;
+
     /**
      * If this loss model uses objects of type RandomVariableStream,
      * set the stream numbers to the integers starting with the offset
@@ -115,6 +136,12 @@ class PropagationLossModel : public Object
      */
     virtual int64_t DoAssignStreams(int64_t stream) = 0;
 
+    /**
+     * @param b the mobility models of a set of nodes
+     * @return the position of each node
+     */
+    static std::vector<Vector> GetPositions(const std::vector<Ptr<MobilityModel>>& b);
+
   private:
     /**
      * PropagationLossModel.
@@ -128,6 +155,22 @@ class PropagationLossModel : public Object
                                  Ptr<MobilityModel> a,
                                  Ptr<MobilityModel> b) const = 0;
 
+    /**
+     * Apply the loss of this model to a set of destinations. The default
+     * implementation calls DoCalcRxPower for each destination in turn;
+     * models whose loss is a closed-form function of the positions override
+     * it to fetch the position of the source once and to evaluate the loss
+     * in a tight loop.
+     *
+     * @param a the mobility model of the source
+     * @param b the mobility models of the destinations
+     * @param powerDbm the power (in dBm) at each destination, before the loss of this model on
+     *        input and after it on output
+     */
+    virtual void DoCalcRxPowerBatch(Ptr<MobilityModel> a,
+                                    const std::vector<Ptr<MobilityModel>>& b,
+                                    std::vector<double>& powerDbm) const;
+
     Ptr<PropagationLossModel> m_next; //!< Next propagation loss model in the list
 };
 
@@ -294,6 +337,16 @@ class FriisPropagationLossModel : public PropagationLossModel
     double DoCalcRxPower(double txPowerDbm,
                          Ptr<MobilityModel> a,
                          Ptr<MobilityModel> b) const override;
+    void DoCalcRxPowerBatch(Ptr<MobilityModel> a,
+                            const std::vector<Ptr<MobilityModel>>& b,
+                            std::vector<double>& powerDbm) const override;
+
+    /**
+     * @param txPowerDbm current transmission power (in dBm)
+     * @param distance the distance between the source and the destination (in meters)
+     * @returns the reception power after adding propagation loss (in dBm)
+     */
+    double CalcRxPowerAtDistance(double txPowerDbm, double distance) const;
     int64_t DoAssignStreams(int64_t stream) override;
 
     /**
@@ -406,6 +459,17 @@ class TwoRayGroundPropagationLossModel : public PropagationLossModel
     double DoCalcRxPower(double txPowerDbm,
                          Ptr<MobilityModel> a,
                          Ptr<MobilityModel> b) const override;
+    void DoCalcRxPowerBatch(Ptr<MobilityModel> a,
+                            const std::vector<Ptr<MobilityModel>>& b,
+                            std::vector<double>& powerDbm) const override;
+
+    /**
+     * @param txPowerDbm current transmission power (in dBm)
+     * @param a the position of the source
+     * @param b the position of the destination
+     * @returns the reception power after adding propagation loss (in dBm)
+     */
+    double CalcRxPowerAtPositions(double txPowerDbm, const Vector& a, const Vector& b) const;
     int64_t DoAssignStreams(int64_t stream) override;
 
     /**
@@ -484,6 +548,16 @@ class LogDistancePropagationLossModel : public PropagationLossModel
     double DoCalcRxPower(double txPowerDbm,
                          Ptr<MobilityModel> a,
                          Ptr<MobilityModel> b) const override;
+    void DoCalcRxPowerBatch(Ptr<MobilityModel> a,
+                            const std::vector<Ptr<MobilityModel>>& b,
+                            std::vector<double>& powerDbm) const override;
+
+    /**
+     * @param txPowerDbm current transmission power (in dBm)
+     * @param distance the distance between the source and the destination (in meters)
+     * @returns the reception power after adding propagation loss (in dBm)
+     */
+    double CalcRxPowerAtDistance(double txPowerDbm, double distance) const;
 
     int64_t DoAssignStreams(int64_t stream) override;
 
@@ -560,6 +634,16 @@ class ThreeLogDistancePropagationLossModel : public PropagationLossModel
     double DoCalcRxPower(double txPowerDbm,
                          Ptr<MobilityModel> a,
                          Ptr<MobilityModel> b) const override;
+    void DoCalcRxPowerBatch(Ptr<MobilityModel> a,
+                            const std::vector<Ptr<MobilityModel>>& b,
+                            std::vector<double>& powerDbm) const override;
+
+    /**
+     * @param txPowerDbm current transmission power (in dBm)
+     * @param distance the distance between the source and the destination (in meters)
+     * @returns the reception power after adding propagation loss (in dBm)
+     */
+    double CalcRxPowerAtDistance(double txPowerDbm, double distance) const;
 
     int64_t DoAssignStreams(int64_t stream) override;
 
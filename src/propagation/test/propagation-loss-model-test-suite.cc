@@ -7,8 +7,10 @@
 #include "ns3/abort.h"
 #include "ns3/config.h"
 #include "ns3/constant-position-mobility-model.h"
+#include "ns3/cost231-propagation-loss-model.h"
 #include "ns3/double.h"
 #include "ns3/log.h"
+#include "ns3/okumura-hata-propagation-loss-model.h"
 #include "ns3/propagation-loss-model.h"
 #include "ns3/simulator.h"
 #include "ns3/test.h"
@@ -478,6 +480,83 @@ RangePropagationLossModelTestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * @ingroup propagation-tests
+ *
+ * @brief Check that PropagationLossModel::CalcRxPowerBatch returns the same
+ * values as PropagationLossModel::CalcRxPower for chains of models.
+ */
+class BatchPropagationLossModelTestCase : public TestCase
+{
+  public:
+    BatchPropagationLossModelTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+BatchPropagationLossModelTestCase::BatchPropagationLossModelTestCase()
+    : TestCase("Test PropagationLossModel::CalcRxPowerBatch")
+{
+}
+
+void
+BatchPropagationLossModelTestCase::DoRun()
+{
+    Ptr<MobilityModel> a = CreateObject<ConstantPositionMobilityModel>();
+    a->SetPosition(Vector(3, -2, 30));
+    std::vector<Ptr<MobilityModel>> b;
+    for (int i = 0; i < 50; ++i)
+    {
+        b.push_back(CreateObject<ConstantPositionMobilityModel>());
+        // distances from a few meters to a few kilometers, and a colocated receiver
+        b.back()->SetPosition(
+            i == 0 ? a->GetPosition() : Vector((i * i * 37) % 3001, (i * 53) % 701, 1.5 + i % 3));
+    }
+
+    std::vector<std::vector<Ptr<PropagationLossModel>>> chains{
+        {CreateObject<FriisPropagationLossModel>()},
+        {CreateObject<TwoRayGroundPropagationLossModel>()},
+        {CreateObject<LogDistancePropagationLossModel>()},
+        {CreateObject<ThreeLogDistancePropagationLossModel>()},
+        {CreateObject<Cost231PropagationLossModel>()},
+        {CreateObject<OkumuraHataPropagationLossModel>()},
+        {CreateObject<LogDistancePropagationLossModel>(),
+         CreateObject<NakagamiPropagationLossModel>(),
+         CreateObject<RangePropagationLossModel>()},
+    };
+
+    for (const auto& chain : chains)
+    {
+        for (std::size_t i = 1; i < chain.size(); ++i)
+        {
+            chain[i - 1]->SetNext(chain[i]);
+        }
+        const auto& model = chain.front();
+
+        model->AssignStreams(1);
+        std::vector<double> expected;
+        for (const auto& mobility : b)
+        {
+            expected.push_back(model->CalcRxPower(16, a, mobility));
+        }
+
+        model->AssignStreams(1);
+        std::vector<double> rxPowerDbm;
+        model->CalcRxPowerBatch(16, a, b, rxPowerDbm);
+
+        NS_TEST_ASSERT_MSG_EQ(rxPowerDbm.size(), b.size(), "Unexpected number of RX powers");
+        for (std::size_t i = 0; i < b.size(); ++i)
+        {
+            NS_TEST_EXPECT_MSG_EQ(rxPowerDbm[i],
+                                  expected[i],
+                                  "Unexpected RX power for receiver "
+                                      << i << " with " << model->GetInstanceTypeId().GetName());
+        }
+    }
+    Simulator::Destroy();
+}
+
 /**
  * @ingroup propagation-tests
  *
@@ -489,6 +568,7 @@ RangePropagationLossModelTestCase::DoRun()
  *   - LogDistancePropagationLossModel
  *   - MatrixPropagationLossModel
  *   - RangePropagationLossModel
+ *   - PropagationLossModel::CalcRxPowerBatch
  */
 class PropagationLossModelsTestSuite : public TestSuite
 {
@@ -504,6 +584,7 @@ PropagationLossModelsTestSuite::PropagationLossModelsTestSuite()
     AddTestCase(new LogDistancePropagationLossModelTestCase, TestCase::Duration::QUICK);
     AddTestCase(new MatrixPropagationLossModelTestCase, TestCase::Duration::QUICK);
     AddTestCase(new RangePropagationLossModelTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new BatchPropagationLossModelTestCase, TestCase::Duration::QUICK);
 }
 
 /// Static variable for test initialization
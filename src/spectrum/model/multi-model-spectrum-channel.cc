@@ -17,6 +17,7 @@
 #include "ns3/antenna-model.h"
 #include "ns3/double.h"
 #include "ns3/log.h"
+#include "ns3/mobility-grid-index.h"
 #include "ns3/mobility-model.h"
 #include "ns3/net-device.h"
 #include "ns3/node.h"
@@ -70,7 +71,8 @@ RxSpectrumModelInfo::RxSpectrumModelInfo(Ptr<const SpectrumModel> rxSpectrumMode
 }
 
 MultiModelSpectrumChannel::MultiModelSpectrumChannel()
-    : m_numDevices{0}
+    : m_numDevices{0},
+      m_maxRange{0}
 {
     NS_LOG_FUNCTION(this);
 }
@@ -81,18 +83,27 @@ MultiModelSpectrumChannel::DoDispose()
     NS_LOG_FUNCTION(this);
     m_txSpectrumModelInfoMap.clear();
     m_rxSpectrumModelInfoMap.clear();
+    m_rxIndex = nullptr;
+    m_indexedRxPhys.clear();
     SpectrumChannel::DoDispose();
 }
 
 TypeId
 MultiModelSpectrumChannel::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::MultiModelSpectrumChannel")
-                            .SetParent<SpectrumChannel>()
-                            .SetGroupName("Spectrum")
-                            .AddConstructor<MultiModelSpectrumChannel>()
-
-        ;
+    static TypeId tid =
+        TypeId("ns3::MultiModelSpectrumChannel")
+            .SetParent<SpectrumChannel>()
+            .SetGroupName("Spectrum")
+            .AddConstructor<MultiModelSpectrumChannel>()
+            .AddAttribute("MaxRange",
+                          "If positive, the receivers farther than this distance (in meters) from "
+                          "the transmitter are not reached by its signals, and neither the signal "
+                          "parameters are copied nor the propagation models evaluated for them. "
+                          "Receivers without a mobility model are always reached.",
+                          DoubleValue(0),
+                          MakeDoubleAccessor(&MultiModelSpectrumChannel::m_maxRange),
+                          MakeDoubleChecker<double>(0));
     return tid;
 }
 
@@ -101,6 +112,8 @@ MultiModelSpectrumChannel::RemoveRx(Ptr<SpectrumPhy> phy)
 {
     NS_LOG_FUNCTION(this << phy);
 
+    m_rxIndex = nullptr;
+
     // remove a previous entry of this phy if it exists
     // we need to scan for all rxSpectrumModel values since we don't
     // know which spectrum model the phy had when it was previously added
@@ -268,6 +281,25 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
         convertedPsds.emplace(rxSpectrumModelUid, convertedTxPowerSpectrum);
     }
 
+    if (m_maxRange > 0 && txMobility)
+    {
+        if (!m_rxIndex)
+        {
+            BuildRxIndex();
+        }
+        // the receivers are indexed in the order in which they are visited below, hence
+        // receptions are scheduled in the same order as without range limit
+        for (auto id : m_rxIndex->GetItemsInRange(txMobility, m_maxRange))
+        {
+            const auto& [rxPhy, rxSpectrumModelUid] = m_indexedRxPhys[id];
+            if (convertedPsds.contains(rxSpectrumModelUid))
+            {
+                ScheduleStartRx(txParams, rxPhy, rxSpectrumModelUid, convertedPsds);
+            }
+        }
+        return;
+    }
+
     for (auto rxInfoIterator = m_rxSpectrumModelInfoMap.begin();
          rxInfoIterator != m_rxSpectrumModelInfoMap.end();
          ++rxInfoIterator)
@@ -281,86 +313,112 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
             continue;
         }
 
-        for (auto rxPhyIterator = rxInfoIterator->second.m_rxPhys.begin();
-             rxPhyIterator != rxInfoIterator->second.m_rxPhys.end();
-             ++rxPhyIterator)
+        for (const auto& rxPhy : rxInfoIterator->second.m_rxPhys)
         {
-            NS_ASSERT_MSG((*rxPhyIterator)->GetRxSpectrumModel()->GetUid() == rxSpectrumModelUid,
-                          "SpectrumModel change was not notified to MultiModelSpectrumChannel "
-                          "(i.e., AddRx should be called again after model is changed)");
+            ScheduleStartRx(txParams, rxPhy, rxSpectrumModelUid, convertedPsds);
+        }
+    }
+}
 
-            auto txAntennaGain{0.0};
-            if ((*rxPhyIterator) != txParams->txPhy)
-            {
-                auto rxNetDevice = (*rxPhyIterator)->GetDevice();
-                auto txNetDevice = txParams->txPhy->GetDevice();
-
-                if (rxNetDevice && txNetDevice)
-                {
-                    // we assume that devices are attached to a node
-                    if (rxNetDevice->GetNode()->GetId() == txNetDevice->GetNode()->GetId())
-                    {
-                        NS_LOG_DEBUG(
-                            "Skipping the pathloss calculation among different antennas of the "
-                            "same node, not supported yet by any pathloss model in ns-3.");
-                        continue;
-                    }
-                }
-
-                if (m_filter && m_filter->Filter(txParams, *rxPhyIterator))
-                {
-                    continue;
-                }
-
-                NS_LOG_LOGIC("copying signal parameters " << txParams);
-                auto rxParams = txParams->Copy();
-                rxParams->psd = Copy<SpectrumValue>(convertedPsds.at(rxSpectrumModelUid));
-                Time delay{0};
-
-                auto receiverMobility = (*rxPhyIterator)->GetMobility();
-
-                if (txMobility && receiverMobility)
-                {
-                    if (rxParams->txAntenna)
-                    {
-                        Angles txAngles(receiverMobility->GetPosition(), txMobility->GetPosition());
-                        txAntennaGain = rxParams->txAntenna->GetGainDb(txAngles);
-                        NS_LOG_LOGIC("txAntennaGain = " << txAntennaGain << " dB");
-                    }
-                    if (m_propagationDelay)
-                    {
-                        delay = m_propagationDelay->GetDelay(txMobility, receiverMobility);
-                    }
-                }
-
-                if (rxNetDevice)
-                {
-                    // the receiver has a NetDevice, so we expect that it is attached to a Node
-                    auto dstNode = rxNetDevice->GetNode()->GetId();
-                    Simulator::ScheduleWithContext(dstNode,
-                                                   delay,
-                                                   &MultiModelSpectrumChannel::StartRx,
-                                                   this,
-                                                   txParams->psd,
-                                                   txAntennaGain,
-                                                   rxParams,
-                                                   *rxPhyIterator,
-                                                   convertedPsds);
-                }
-                else
-                {
-                    // the receiver is not attached to a NetDevice, so we cannot assume that it is
-                    // attached to a node
-                    Simulator::Schedule(delay,
-                                        &MultiModelSpectrumChannel::StartRx,
-                                        this,
-                                        txParams->psd,
-                                        txAntennaGain,
-                                        rxParams,
-                                        *rxPhyIterator,
-                                        convertedPsds);
-                }
-            }
+void
+MultiModelSpectrumChannel::ScheduleStartRx(
+    Ptr<SpectrumSignalParameters> txParams,
+    Ptr<SpectrumPhy> rxPhy,
+    SpectrumModelUid_t rxSpectrumModelUid,
+    const std::map<SpectrumModelUid_t, Ptr<SpectrumValue>>& convertedPsds)
+{
+    NS_ASSERT_MSG(rxPhy->GetRxSpectrumModel()->GetUid() == rxSpectrumModelUid,
+                  "SpectrumModel change was not notified to MultiModelSpectrumChannel "
+                  "(i.e., AddRx should be called again after model is changed)");
+
+    if (rxPhy == txParams->txPhy)
+    {
+        return;
+    }
+
+    auto rxNetDevice = rxPhy->GetDevice();
+    auto txNetDevice = txParams->txPhy->GetDevice();
+
+    if (rxNetDevice && txNetDevice)
+    {
+        // we assume that devices are attached to a node
+        if (rxNetDevice->GetNode()->GetId() == txNetDevice->GetNode()->GetId())
+        {
+            NS_LOG_DEBUG("Skipping the pathloss calculation among different antennas of the "
+                         "same node, not supported yet by any pathloss model in ns-3.");
+            return;
+        }
+    }
+
+    if (m_filter && m_filter->Filter(txParams, rxPhy))
+    {
+        return;
+    }
+
+    NS_LOG_LOGIC("copying signal parameters " << txParams);
+    auto rxParams = txParams->Copy();
+    rxParams->psd = Copy<SpectrumValue>(convertedPsds.at(rxSpectrumModelUid));
+    Time delay{0};
+    auto txAntennaGain{0.0};
+
+    auto txMobility = txParams->txPhy->GetMobility();
+    auto receiverMobility = rxPhy->GetMobility();
+
+    if (txMobility && receiverMobility)
+    {
+        if (rxParams->txAntenna)
+        {
+            Angles txAngles(receiverMobility->GetPosition(), txMobility->GetPosition());
+            txAntennaGain = rxParams->txAntenna->GetGainDb(txAngles);
+            NS_LOG_LOGIC("txAntennaGain = " << txAntennaGain << " dB");
+        }
+        if (m_propagationDelay)
+        {
+            delay = m_propagationDelay->GetDelay(txMobility, receiverMobility);
+        }
+    }
+
+    if (rxNetDevice)
+    {
+        // the receiver has a NetDevice, so we expect that it is attached to a Node
+        auto dstNode = rxNetDevice->GetNode()->GetId();
+        Simulator::ScheduleWithContext(dstNode,
+                                       delay,
+                                       &MultiModelSpectrumChannel::StartRx,
+                                       this,
+                                       txParams->psd,
+                                       txAntennaGain,
+                                       rxParams,
+                                       rxPhy,
+                                       convertedPsds);
+    }
+    else
+    {
+        // the receiver is not attached to a NetDevice, so we cannot assume that it is
+        // attached to a node
+        Simulator::Schedule(delay,
+                            &MultiModelSpectrumChannel::StartRx,
+                            this,
+                            txParams->psd,
+                            txAntennaGain,
+                            rxParams,
+                            rxPhy,
+                            convertedPsds);
+    }
+}
+
+void
+MultiModelSpectrumChannel::BuildRxIndex()
+{
+    NS_LOG_FUNCTION(this);
+    m_rxIndex = Create<MobilityGridIndex>(m_maxRange);
+    m_indexedRxPhys.clear();
+    for (const auto& [rxSpectrumModelUid, rxInfo] : m_rxSpectrumModelInfoMap)
+    {
+        for (const auto& rxPhy : rxInfo.m_rxPhys)
+        {
+            m_rxIndex->Add(rxPhy->GetMobility());
+            m_indexedRxPhys.emplace_back(rxPhy, rxSpectrumModelUid);
         }
     }
 }
@@ -18,10 +18,13 @@
 
 #include <map>
 #include <set>
+#include <vector>
 
 namespace ns3
 {
 
+class MobilityGridIndex;
+
 /**
  * @ingroup spectrum
  * Container: SpectrumModelUid_t, SpectrumConverter
@@ -88,6 +91,14 @@ typedef std::map<SpectrumModelUid_t, RxSpectrumModelInfo> RxSpectrumModelInfoMap
  * for this to work is that, after the SpectrumPhy switched its
  * SpectrumModel,  MultiModelSpectrumChannel::AddRx () is
  * called again passing the pointer to that SpectrumPhy.
+ *
+ * If the MaxRange attribute is set, the receivers are looked up in a
+ * MobilityGridIndex and those farther than MaxRange from the transmitter
+ * are skipped before the signal parameters are copied, so that the cost
+ * of a transmission depends on the number of receivers in range rather
+ * than on the total number of receivers. Unlike MaxLossDb, which discards
+ * a signal after its path loss is computed, this bypasses the propagation
+ * models for the receivers beyond MaxRange.
  */
 class MultiModelSpectrumChannel : public SpectrumChannel
 {
@@ -142,6 +153,25 @@ class MultiModelSpectrumChannel : public SpectrumChannel
         Ptr<SpectrumPhy> receiver,
         const std::map<SpectrumModelUid_t, Ptr<SpectrumValue>>& availableConvertedPsds);
 
+    /**
+     * Used internally by StartTx to compute the delay and the TX antenna gain
+     * of a signal towards a receiver and to schedule its reception.
+     *
+     * @param txParams The signal parameters.
+     * @param rxPhy A pointer to the receiver SpectrumPhy.
+     * @param rxSpectrumModelUid The UID of the RX SpectrumModel of the receiver.
+     * @param convertedPsds The TX PSD converted to each RX SpectrumModel.
+     */
+    void ScheduleStartRx(Ptr<SpectrumSignalParameters> txParams,
+                         Ptr<SpectrumPhy> rxPhy,
+                         SpectrumModelUid_t rxSpectrumModelUid,
+                         const std::map<SpectrumModelUid_t, Ptr<SpectrumValue>>& convertedPsds);
+
+    /**
+     * Build the spatial index of the receivers, used when MaxRange is set.
+     */
+    void BuildRxIndex();
+
     /**
      * Data structure holding, for each TX SpectrumModel,  all the
      * converters to any RX SpectrumModel, and all the corresponding
@@ -160,6 +190,19 @@ class MultiModelSpectrumChannel : public SpectrumChannel
      * Number of devices connected to the channel.
      */
     std::size_t m_numDevices;
+
+    double m_maxRange; //!< Maximum distance reached by the signals, in meters (0 means unlimited)
+
+    /**
+     * Spatial index of the receivers, built on demand and reset whenever a
+     * receiver is added or removed.
+     */
+    Ptr<MobilityGridIndex> m_rxIndex;
+
+    /**
+     * The receivers in m_rxIndex, with their RX SpectrumModel UID, by identifier.
+     */
+    std::vector<std::pair<Ptr<SpectrumPhy>, SpectrumModelUid_t>> m_indexedRxPhys;
 };
 
 } // namespace ns3
@@ -0,0 +1,62 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "error-rate-lookup-table.h"
+
+#include "wifi-utils.h"
+
+#include "ns3/assert.h"
+#include "ns3/log.h"
+
+#include <cmath>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("ErrorRateLookupTable");
+
+ErrorRateLookupTable::ErrorRateLookupTable(ErrorRateFunction function,
+                                           dB_u min,
+                                           dB_u max,
+                                           dB_u step)
+    : m_function(function),
+      m_min(min),
+      m_step(step)
+{
+    NS_LOG_FUNCTION(this << min << max << step);
+    NS_ASSERT(step > 0 && max > min);
+    const auto size = static_cast<std::size_t>(std::ceil((max - min) / step)) + 1;
+    m_logErrorRates.reserve(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        // std::log (0) is -infinity, which Get handles
+        m_logErrorRates.push_back(std::log(m_function(DbToRatio(m_min + i * m_step))));
+    }
+}
+
+double
+ErrorRateLookupTable::Get(double ratio) const
+{
+    if (ratio <= 0)
+    {
+        return m_function(ratio);
+    }
+    const auto position = (RatioToDb(ratio) - m_min) / m_step;
+    if (position < 0 || position >= m_logErrorRates.size() - 1)
+    {
+        return m_function(ratio);
+    }
+    const auto index = static_cast<std::size_t>(position);
+    const auto fraction = position - index;
+    const auto low = m_logErrorRates[index];
+    const auto high = m_logErrorRates[index + 1];
+    if (std::isinf(low) || std::isinf(high))
+    {
+        // the error rate vanishes within this interval, the logarithm cannot be interpolated
+        return (1 - fraction) * std::exp(low) + fraction * std::exp(high);
+    }
+    return std::exp(low + fraction * (high - low));
+}
+
+} // namespace ns3
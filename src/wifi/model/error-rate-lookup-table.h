@@ -0,0 +1,60 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef ERROR_RATE_LOOKUP_TABLE_H
+#define ERROR_RATE_LOOKUP_TABLE_H
+
+#include "ns3/wifi-units.h"
+
+#include <functional>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup wifi
+ * @brief Interpolated table of a bit error rate as a function of a signal to noise ratio
+ *
+ * The table samples a decreasing error rate function on a regular grid of
+ * ratios expressed in dB and interpolates the logarithm of the error rate
+ * linearly in between, which closely follows the waterfall shape of the
+ * curves. Ratios outside of the grid are passed to the function itself.
+ * This is used by the analytic error rate models to avoid evaluating their
+ * closed forms for every chunk of every received frame.
+ */
+class ErrorRateLookupTable
+{
+  public:
+    /// Error rate as a function of a signal to noise ratio in linear scale
+    using ErrorRateFunction = std::function<double(double)>;
+
+    /**
+     * Sample the given function
+     * @param function the error rate function, which must be valid over the whole grid
+     * @param min the lowest ratio of the grid
+     * @param max the highest ratio of the grid
+     * @param step the distance between two ratios of the grid
+     */
+    ErrorRateLookupTable(ErrorRateFunction function,
+                         dB_u min = dB_u{-10},
+                         dB_u max = dB_u{60},
+                         dB_u step = dB_u{0.05});
+
+    /**
+     * @param ratio the signal to noise ratio (in linear scale)
+     * @return the interpolated error rate at the given ratio
+     */
+    double Get(double ratio) const;
+
+  private:
+    ErrorRateFunction m_function;        //!< the tabulated function
+    dB_u m_min;                          //!< the lowest ratio of the grid
+    dB_u m_step;                         //!< the distance between two ratios of the grid
+    std::vector<double> m_logErrorRates; //!< the logarithm of the error rate at each ratio
+};
+
+} // namespace ns3
+
+#endif /* ERROR_RATE_LOOKUP_TABLE_H */
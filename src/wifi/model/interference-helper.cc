@@ -372,10 +372,13 @@ InterferenceHelper::AppendEvent(Ptr<Event> event,
             // HE TB PPDU transmission and the start of HE TB payload.
             m_firstPowers.find(band)->second = previousPowerStart;
         }
-        auto first =
-            AddNiChangeEvent(event->GetStartTime(), NiChange(previousPowerStart, event), niIt);
+        const auto firstIndex =
+            AddNiChangeEvent(event->GetStartTime(), NiChange(previousPowerStart, event), niIt) -
+            niIt->second.begin();
+        // the NiChange at the end time is added after the one at the start time, hence
+        // the latter is not moved
         auto last = AddNiChangeEvent(event->GetEndTime(), NiChange(previousPowerEnd, event), niIt);
-        for (auto i = first; i != last; ++i)
+        for (auto i = niIt->second.begin() + firstIndex; i != last; ++i)
         {
             i->second.AddPower(power);
         }
@@ -445,7 +448,7 @@ InterferenceHelper::CalculateNoiseInterferenceW(Ptr<Event> event,
     auto niIt = m_niChanges.find(band);
     NS_ABORT_IF(niIt == m_niChanges.end());
     const auto now = Simulator::Now();
-    auto it = niIt->second.find(event->GetStartTime());
+    auto it = FindFirstNiChange(event->GetStartTime(), niIt->second);
     const auto muMimoPower = (event->GetPpdu()->GetType() == WIFI_PPDU_TYPE_UL_MU)
                                  ? CalculateMuMimoPowerW(event, band)
                                  : Watt_u{0.0};
@@ -465,20 +468,23 @@ InterferenceHelper::CalculateNoiseInterferenceW(Ptr<Event> event,
             noiseInterference = Watt_u{0.0};
         }
     }
-    it = niIt->second.find(event->GetStartTime());
+    it = FindFirstNiChange(event->GetStartTime(), niIt->second);
     NS_ABORT_IF(it == niIt->second.end());
     for (; it != niIt->second.end() && it->second.GetEvent() != event; ++it)
     {
         ;
     }
-    NiChanges ni;
-    ni.emplace(event->GetStartTime(), NiChange(Watt_u{0}, event));
+    const auto eventStart = it;
     while (++it != niIt->second.end() && it->second.GetEvent() != event)
     {
-        ni.insert(*it);
+        ;
     }
-    ni.emplace(event->GetEndTime(), NiChange(Watt_u{0}, event));
-    nis.insert({band, ni});
+    NiChanges ni;
+    ni.reserve(it - eventStart + 1);
+    ni.emplace_back(event->GetStartTime(), NiChange(Watt_u{0}, event));
+    ni.insert(ni.end(), eventStart + 1, it);
+    ni.emplace_back(event->GetEndTime(), NiChange(Watt_u{0}, event));
+    nis.insert({band, std::move(ni)});
     NS_ASSERT_MSG(noiseInterference >= Watt_u{0.0},
                   "CalculateNoiseInterferenceW returns negative value " << noiseInterference);
     return noiseInterference;
@@ -655,8 +661,8 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
 {
     NS_LOG_FUNCTION(this << band);
     double psr = 1.0; /* Packet Success Rate */
-    auto niIt = nis->find(band)->second;
-    auto j = niIt.begin();
+    const auto& niIt = nis->find(band)->second;
+    auto j = niIt.cbegin();
 
     NS_ASSERT(!phyHeaderSections.empty());
     Time stopLastSection;
@@ -669,7 +675,7 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
     NS_ABORT_IF(!m_firstPowers.contains(band));
     auto noiseInterference = m_firstPowers.at(band);
     const auto power = event->GetRxPower(band);
-    while (++j != niIt.end())
+    while (++j != niIt.cend())
     {
         auto current = j->first;
         NS_LOG_DEBUG("previous= " << previous << ", current=" << current);
@@ -717,7 +723,7 @@ InterferenceHelper::CalculatePhyHeaderPer(Ptr<const Event> event,
                                           WifiPpduField header) const
 {
     NS_LOG_FUNCTION(this << band << header);
-    auto niIt = nis->find(band)->second;
+    const auto& niIt = nis->find(band)->second;
     auto phyEntity =
         WifiPhy::GetStaticPhyEntity(event->GetPpdu()->GetTxVector().GetModulationClass());
 
@@ -797,7 +803,24 @@ InterferenceHelper::CalculatePhyHeaderSnrPer(Ptr<Event> event,
 InterferenceHelper::NiChanges::iterator
 InterferenceHelper::GetNextPosition(Time moment, NiChangesPerBand::iterator niIt)
 {
-    return niIt->second.upper_bound(moment);
+    return std::upper_bound(niIt->second.begin(),
+                            niIt->second.end(),
+                            moment,
+                            [](Time moment, const auto& niChange) {
+                                return moment < niChange.first;
+                            });
+}
+
+InterferenceHelper::NiChanges::const_iterator
+InterferenceHelper::FindFirstNiChange(Time moment, const NiChanges& niChanges)
+{
+    auto it = std::lower_bound(niChanges.cbegin(),
+                               niChanges.cend(),
+                               moment,
+                               [](const auto& niChange, Time moment) {
+                                   return niChange.first < moment;
+                               });
+    return (it != niChanges.cend() && it->first == moment) ? it : niChanges.cend();
 }
 
 InterferenceHelper::NiChanges::iterator
@@ -813,7 +836,7 @@ InterferenceHelper::GetPreviousPosition(Time moment, NiChangesPerBand::iterator
 InterferenceHelper::NiChanges::iterator
 InterferenceHelper::AddNiChangeEvent(Time moment, NiChange change, NiChangesPerBand::iterator niIt)
 {
-    return niIt->second.insert(GetNextPosition(moment, niIt), {moment, change});
+    return niIt->second.emplace(GetNextPosition(moment, niIt), moment, change);
 }
 
 void
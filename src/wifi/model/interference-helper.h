@@ -13,6 +13,9 @@
 
 #include "ns3/object.h"
 
+#include <utility>
+#include <vector>
+
 namespace ns3
 {
 
@@ -241,11 +244,12 @@ class InterferenceHelper : public Object
      *
      * @return struct of SNR and PER (with PER being evaluated over the provided time window)
      */
-    PhyEntity::SnrPer CalculatePayloadSnrPer(Ptr<Event> event,
-                                             MHz_u channelWidth,
-                                             const WifiSpectrumBandInfo& band,
-                                             uint16_t staId,
-                                             std::pair<Time, Time> relativeMpduStartStop) const;
+    virtual PhyEntity::SnrPer CalculatePayloadSnrPer(
+        Ptr<Event> event,
+        MHz_u channelWidth,
+        const WifiSpectrumBandInfo& band,
+        uint16_t staId,
+        std::pair<Time, Time> relativeMpduStartStop) const;
     /**
      * Calculate the SNIR for the event (starting from now until the event end).
      *
@@ -271,10 +275,10 @@ class InterferenceHelper : public Object
      *
      * @return struct of SNR and PER
      */
-    PhyEntity::SnrPer CalculatePhyHeaderSnrPer(Ptr<Event> event,
-                                               MHz_u channelWidth,
-                                               const WifiSpectrumBandInfo& band,
-                                               WifiPpduField header) const;
+    virtual PhyEntity::SnrPer CalculatePhyHeaderSnrPer(Ptr<Event> event,
+                                                       MHz_u channelWidth,
+                                                       const WifiSpectrumBandInfo& band,
+                                                       WifiPpduField header) const;
 
     /**
      * Notify that RX has started.
@@ -391,9 +395,13 @@ class InterferenceHelper : public Object
     };
 
     /**
-     * typedef for a multimap of NiChange
+     * Contiguous array of NiChange sorted by time, where NiChanges occurring at the same time
+     * are kept in the order they were added. The power of each NiChange is the total power from
+     * its time on, hence the power at a given time is found by a binary search; insertions and
+     * removals shift the array, which is kept short by discarding the NiChanges that precede the
+     * start of a new reception.
      */
-    using NiChanges = std::multimap<Time, NiChange>;
+    using NiChanges = std::vector<std::pair<Time, NiChange>>;
 
     /**
      * Map of NiChanges per band
@@ -407,6 +415,39 @@ class InterferenceHelper : public Object
 
     NiChangesPerBand m_niChanges; //!< NI Changes for each band
 
+    /**
+     * Calculate power of all other events preceding a given event that belong to the same MU-MIMO
+     * transmission.
+     *
+     * @param event the event
+     * @param band the band
+     *
+     * @return the power of all other events preceding the event that belong to the same MU-MIMO
+     * transmission
+     */
+    Watt_u CalculateMuMimoPowerW(Ptr<const Event> event, const WifiSpectrumBandInfo& band) const;
+
+    /**
+     * Returns an iterator to the first NiChange occurring at the given moment
+     *
+     * @param moment the time of the NiChange to find
+     * @param niChanges the NiChanges of the band to check
+     * @returns an iterator to the first NiChange at the given moment, or the end iterator if
+     *          there is none
+     */
+    static NiChanges::const_iterator FindFirstNiChange(Time moment, const NiChanges& niChanges);
+
+    /**
+     * Return whether another event is a MU-MIMO event that belongs to the same transmission and to
+     * the same RU.
+     *
+     * @param currentEvent the current event that is being inspected
+     * @param otherEvent the other event to compare against
+     *
+     * @return whether both events belong to the same transmission and to the same RU
+     */
+    bool IsSameMuMimoTransmission(Ptr<const Event> currentEvent, Ptr<const Event> otherEvent) const;
+
   private:
     /**
      * Check whether a given band is tracked by this interference helper.
@@ -449,18 +490,6 @@ class InterferenceHelper : public Object
                                        NiChangesPerBand& nis,
                                        const WifiSpectrumBandInfo& band) const;
 
-    /**
-     * Calculate power of all other events preceding a given event that belong to the same MU-MIMO
-     * transmission.
-     *
-     * @param event the event
-     * @param band the band
-     *
-     * @return the power of all other events preceding the event that belong to the same MU-MIMO
-     * transmission
-     */
-    Watt_u CalculateMuMimoPowerW(Ptr<const Event> event, const WifiSpectrumBandInfo& band) const;
-
     /**
      * Calculate the error rate of the given PHY payload only in the provided time
      * window (thus enabling per MPDU PER information). The PHY payload can be divided into
@@ -536,10 +565,10 @@ class InterferenceHelper : public Object
      * @returns an iterator to the list of NiChanges
      */
     NiChanges::iterator GetPreviousPosition(Time moment, NiChangesPerBand::iterator niIt);
-
     /**
      * Add NiChange to the list at the appropriate position and
-     * return the iterator of the new event.
+     * return the iterator of the new event. The iterators to the
+     * NiChanges of the band are invalidated.
      *
      * @param moment time to check from
      * @param change the NiChange to add
@@ -549,17 +578,6 @@ class InterferenceHelper : public Object
     NiChanges::iterator AddNiChangeEvent(Time moment,
                                          NiChange change,
                                          NiChangesPerBand::iterator niIt);
-
-    /**
-     * Return whether another event is a MU-MIMO event that belongs to the same transmission and to
-     * the same RU.
-     *
-     * @param currentEvent the current event that is being inspected
-     * @param otherEvent the other event to compare against
-     *
-     * @return whether both events belong to the same transmission and to the same RU
-     */
-    bool IsSameMuMimoTransmission(Ptr<const Event> currentEvent, Ptr<const Event> otherEvent) const;
 };
 
 } // namespace ns3
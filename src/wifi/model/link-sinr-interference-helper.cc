@@ -0,0 +1,125 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "link-sinr-interference-helper.h"
+
+#include "wifi-phy.h"
+#include "wifi-ppdu.h"
+
+#include "ns3/log.h"
+
+#include <algorithm>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("LinkSinrInterferenceHelper");
+
+NS_OBJECT_ENSURE_REGISTERED(LinkSinrInterferenceHelper);
+
+TypeId
+LinkSinrInterferenceHelper::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::LinkSinrInterferenceHelper")
+                            .SetParent<InterferenceHelper>()
+                            .SetGroupName("Wifi")
+                            .AddConstructor<LinkSinrInterferenceHelper>();
+    return tid;
+}
+
+PhyEntity::SnrPer
+LinkSinrInterferenceHelper::CalculatePayloadSnrPer(
+    Ptr<Event> event,
+    MHz_u channelWidth,
+    const WifiSpectrumBandInfo& band,
+    uint16_t staId,
+    std::pair<Time, Time> relativeMpduStartStop) const
+{
+    NS_LOG_FUNCTION(this << channelWidth << band << staId << relativeMpduStartStop.first
+                         << relativeMpduStartStop.second);
+    const auto& txVector = event->GetPpdu()->GetTxVector();
+    auto phyPayloadStart = event->GetStartTime();
+    if (event->GetPpdu()->GetType() != WIFI_PPDU_TYPE_UL_MU &&
+        event->GetPpdu()->GetType() != WIFI_PPDU_TYPE_DL_MU)
+    {
+        // the events of MU PPDUs start with the MU payload
+        phyPayloadStart += WifiPhy::CalculatePhyPreambleAndHeaderDuration(txVector);
+    }
+    const auto windowStart = phyPayloadStart + relativeMpduStartStop.first;
+    const auto windowStop = phyPayloadStart + relativeMpduStartStop.second;
+    const auto snr =
+        CalculateSnr(event->GetRxPower(band),
+                     GetMaxNoiseInterferenceW(event, band, windowStart, windowStop),
+                     channelWidth,
+                     txVector.GetNss(staId));
+    const auto per =
+        1 - CalculatePayloadChunkSuccessRate(snr, windowStop - windowStart, txVector, staId);
+    NS_LOG_DEBUG("snr=" << snr << " per=" << per);
+    return PhyEntity::SnrPer(snr, per);
+}
+
+PhyEntity::SnrPer
+LinkSinrInterferenceHelper::CalculatePhyHeaderSnrPer(Ptr<Event> event,
+                                                     MHz_u channelWidth,
+                                                     const WifiSpectrumBandInfo& band,
+                                                     WifiPpduField header) const
+{
+    NS_LOG_FUNCTION(this << band << header);
+    const auto& txVector = event->GetPpdu()->GetTxVector();
+    const auto sections = WifiPhy::GetStaticPhyEntity(txVector.GetModulationClass())
+                              ->GetPhyHeaderSections(txVector, event->GetStartTime());
+    auto it = sections.find(header);
+    if (it == sections.cend())
+    {
+        return PhyEntity::SnrPer(CalculateSnr(event, channelWidth, 1, band), 0.0);
+    }
+    const auto [start, stop] = it->second.first;
+    const auto snr = CalculateSnr(event->GetRxPower(band),
+                                  GetMaxNoiseInterferenceW(event, band, start, stop),
+                                  channelWidth,
+                                  1);
+    const auto per =
+        1 - CalculateChunkSuccessRate(snr, stop - start, it->second.second, txVector, header);
+    NS_LOG_DEBUG("snr=" << snr << " per=" << per);
+    return PhyEntity::SnrPer(snr, per);
+}
+
+Watt_u
+LinkSinrInterferenceHelper::GetMaxNoiseInterferenceW(Ptr<const Event> event,
+                                                     const WifiSpectrumBandInfo& band,
+                                                     Time start,
+                                                     Time stop) const
+{
+    NS_LOG_FUNCTION(this << band << start << stop);
+    auto niIt = m_niChanges.find(band);
+    NS_ABORT_IF(niIt == m_niChanges.end());
+    const auto power = event->GetRxPower(band);
+    auto muMimoPower = (event->GetPpdu()->GetType() == WIFI_PPDU_TYPE_UL_MU)
+                           ? CalculateMuMimoPowerW(event, band)
+                           : Watt_u{0.0};
+    auto previous = event->GetStartTime();
+    Watt_u noiseInterference{0.0};
+    Watt_u maxNoiseInterference{0.0};
+    for (auto it = FindFirstNiChange(event->GetStartTime(), niIt->second);
+         it != niIt->second.cend() && it->first < stop;
+         ++it)
+    {
+        if (it->first > Max(previous, start))
+        {
+            // the previous level lasted until this change, overlapping the window
+            maxNoiseInterference = std::max(maxNoiseInterference, noiseInterference);
+        }
+        if (IsSameMuMimoTransmission(event, it->second.GetEvent()) &&
+            (event != it->second.GetEvent()))
+        {
+            muMimoPower += it->second.GetEvent()->GetRxPower(band);
+        }
+        noiseInterference = std::max(it->second.GetPower() - power - muMimoPower, Watt_u{0.0});
+        previous = it->first;
+    }
+    // the last level lasts until the end of the window
+    return std::max(maxNoiseInterference, noiseInterference);
+}
+
+} // namespace ns3
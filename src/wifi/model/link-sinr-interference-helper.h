@@ -0,0 +1,76 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef LINK_SINR_INTERFERENCE_HELPER_H
+#define LINK_SINR_INTERFERENCE_HELPER_H
+
+#include "interference-helper.h"
+
+namespace ns3
+{
+
+/**
+ * @ingroup wifi
+ * @brief Abstracted reception model for large scale MAC layer studies
+ *
+ * This interference helper keeps track of the signals on the medium like its
+ * parent class, so that CCA, preamble detection, frame capture and the PHY
+ * state machine behave the same, but it replaces the SINR integration over the
+ * chunks delimited by every interference change with a simple collision
+ * model: each PHY header field and each MPDU is decided at once from a single
+ * link SINR, i.e. the ratio between the received power of the PPDU and the
+ * noise plus the strongest interference observed during the field or the
+ * MPDU. The error rate model is thus invoked once per field or MPDU instead
+ * of once per chunk.
+ *
+ * The link SINR of an interference-free reception only depends on the
+ * received power, hence combining this helper with a
+ * MatrixPropagationLossModel (precomputed link budgets) and with an error
+ * rate model in lookup table mode (e.g., NistErrorRateModel::UseLookupTable)
+ * makes the reception of a PPDU a matter of a few table lookups.
+ *
+ * It is selected with WifiPhyHelper::SetInterferenceHelper, for both
+ * YansWifiPhy and SpectrumWifiPhy.
+ */
+class LinkSinrInterferenceHelper : public InterferenceHelper
+{
+  public:
+    /**
+     * @brief Get the type ID.
+     * @return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    PhyEntity::SnrPer CalculatePayloadSnrPer(
+        Ptr<Event> event,
+        MHz_u channelWidth,
+        const WifiSpectrumBandInfo& band,
+        uint16_t staId,
+        std::pair<Time, Time> relativeMpduStartStop) const override;
+    PhyEntity::SnrPer CalculatePhyHeaderSnrPer(Ptr<Event> event,
+                                               MHz_u channelWidth,
+                                               const WifiSpectrumBandInfo& band,
+                                               WifiPpduField header) const override;
+
+  private:
+    /**
+     * Get the strongest noise and interference power (excluding the thermal noise)
+     * observed by an event during a given time window.
+     *
+     * @param event the event
+     * @param band the band
+     * @param start the start of the time window
+     * @param stop the end of the time window
+     *
+     * @return the strongest noise and interference power during the time window
+     */
+    Watt_u GetMaxNoiseInterferenceW(Ptr<const Event> event,
+                                    const WifiSpectrumBandInfo& band,
+                                    Time start,
+                                    Time stop) const;
+};
+
+} // namespace ns3
+
+#endif /* LINK_SINR_INTERFERENCE_HELPER_H */
@@ -11,6 +11,7 @@
 
 #include "wifi-tx-vector.h"
 
+#include "ns3/boolean.h"
 #include "ns3/log.h"
 
 #include <bitset>
@@ -26,14 +27,22 @@ NS_OBJECT_ENSURE_REGISTERED(NistErrorRateModel);
 TypeId
 NistErrorRateModel::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::NistErrorRateModel")
-                            .SetParent<ErrorRateModel>()
-                            .SetGroupName("Wifi")
-                            .AddConstructor<NistErrorRateModel>();
+    static TypeId tid =
+        TypeId("ns3::NistErrorRateModel")
+            .SetParent<ErrorRateModel>()
+            .SetGroupName("Wifi")
+            .AddConstructor<NistErrorRateModel>()
+            .AddAttribute("UseLookupTable",
+                          "Interpolate the coded bit error rate from lookup tables built on "
+                          "first use, instead of evaluating its closed form for every chunk.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&NistErrorRateModel::m_useLookupTable),
+                          MakeBooleanChecker());
     return tid;
 }
 
 NistErrorRateModel::NistErrorRateModel()
+    : m_useLookupTable(false)
 {
 }
 
@@ -169,6 +178,52 @@ NistErrorRateModel::GetFecQamBer(uint16_t constellationSize,
     return pms;
 }
 
+double
+NistErrorRateModel::GetCodedBer(uint16_t constellationSize, uint8_t bValue, double snr) const
+{
+    double ber;
+    if (constellationSize == 2)
+    {
+        ber = GetBpskBer(snr);
+    }
+    else if (constellationSize == 4)
+    {
+        ber = GetQpskBer(snr);
+    }
+    else
+    {
+        ber = GetQamBer(constellationSize, snr);
+    }
+    if (ber == 0.0)
+    {
+        return 0.0;
+    }
+    return std::min(CalculatePe(ber, bValue), 1.0);
+}
+
+double
+NistErrorRateModel::GetTabulatedChunkSuccessRate(uint16_t constellationSize,
+                                                 uint8_t bValue,
+                                                 double snr,
+                                                 uint64_t nbits) const
+{
+    NS_LOG_FUNCTION(this << constellationSize << +bValue << snr << nbits);
+    auto it = m_lookupTables.find({constellationSize, bValue});
+    if (it == m_lookupTables.end())
+    {
+        NS_LOG_DEBUG("Build coded BER table for " << constellationSize << "-QAM and bValue "
+                                                  << +bValue);
+        it = m_lookupTables
+                 .emplace(std::make_pair(constellationSize, bValue),
+                          ErrorRateLookupTable([this, constellationSize, bValue](double x) {
+                              return GetCodedBer(constellationSize, bValue, x);
+                          }))
+                 .first;
+    }
+    const auto pe = it->second.Get(snr);
+    return (pe == 0.0) ? 1.0 : std::pow(1 - pe, nbits);
+}
+
 uint8_t
 NistErrorRateModel::GetBValue(WifiCodeRate codeRate) const
 {
@@ -202,6 +257,13 @@ NistErrorRateModel::DoGetChunkSuccessRate(WifiMode mode,
     NS_LOG_FUNCTION(this << mode << snr << nbits << +numRxAntennas << field << staId);
     if (mode.GetModulationClass() >= WIFI_MOD_CLASS_ERP_OFDM)
     {
+        if (m_useLookupTable)
+        {
+            return GetTabulatedChunkSuccessRate(mode.GetConstellationSize(),
+                                                GetBValue(mode.GetCodeRate()),
+                                                snr,
+                                                nbits);
+        }
         if (mode.GetConstellationSize() == 2)
         {
             return GetFecBpskBer(snr, nbits, GetBValue(mode.GetCodeRate()));
@@ -9,7 +9,11 @@
 #ifndef NIST_ERROR_RATE_MODEL_H
 #define NIST_ERROR_RATE_MODEL_H
 
+#include "error-rate-lookup-table.h"
 #include "error-rate-model.h"
+
+#include <map>
+#include <utility>
 #include "wifi-mode.h"
 
 namespace ns3
@@ -22,6 +26,11 @@ namespace ns3
  * the model description and validation can be found in
  * http://www.nsnam.org/~pei/80211ofdm.pdf.  For DSSS modulations (802.11b),
  * the model uses the DsssErrorRateModel.
+ *
+ * When the UseLookupTable attribute is set, the coded bit error rate of each
+ * combination of constellation size and coding rate is tabulated the first
+ * time it is needed and interpolated afterwards (see ErrorRateLookupTable),
+ * rather than evaluated from its closed form for every chunk.
  */
 class NistErrorRateModel : public ErrorRateModel
 {
@@ -117,6 +126,35 @@ class NistErrorRateModel : public ErrorRateModel
                         double snr,
                         uint64_t nbits,
                         uint8_t bValue) const;
+    /**
+     * Return the coded BER for the given constellation size and coding rate at the given SNR.
+     *
+     * @param constellationSize the constellation size (M)
+     * @param bValue the bValue such that coding rate = bValue / (bValue + 1)
+     * @param snr SNR ratio (in linear scale)
+     *
+     * @return the coded BER, capped to 1
+     */
+    double GetCodedBer(uint16_t constellationSize, uint8_t bValue, double snr) const;
+    /**
+     * Return the chunk success rate for the given constellation size and coding rate,
+     * using the coded BER interpolated from a lookup table.
+     *
+     * @param constellationSize the constellation size (M)
+     * @param bValue the bValue such that coding rate = bValue / (bValue + 1)
+     * @param snr SNR ratio (in linear scale)
+     * @param nbits the number of bits in the chunk
+     *
+     * @return the chunk success rate
+     */
+    double GetTabulatedChunkSuccessRate(uint16_t constellationSize,
+                                        uint8_t bValue,
+                                        double snr,
+                                        uint64_t nbits) const;
+
+    bool m_useLookupTable; //!< whether to interpolate the coded BER from lookup tables
+    mutable std::map<std::pair<uint16_t, uint8_t>, ErrorRateLookupTable>
+        m_lookupTables; //!< coded BER tables indexed by constellation size and bValue
 };
 
 } // namespace ns3
@@ -12,6 +12,7 @@
 #include "wifi-tx-vector.h"
 #include "wifi-utils.h"
 
+#include "ns3/boolean.h"
 #include "ns3/log.h"
 
 #include <cmath>
@@ -26,14 +27,23 @@ NS_OBJECT_ENSURE_REGISTERED(YansErrorRateModel);
 TypeId
 YansErrorRateModel::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::YansErrorRateModel")
-                            .SetParent<ErrorRateModel>()
-                            .SetGroupName("Wifi")
-                            .AddConstructor<YansErrorRateModel>();
+    static TypeId tid =
+        TypeId("ns3::YansErrorRateModel")
+            .SetParent<ErrorRateModel>()
+            .SetGroupName("Wifi")
+            .AddConstructor<YansErrorRateModel>()
+            .AddAttribute("UseLookupTable",
+                          "Interpolate the coded bit error rate of OFDM modulations from lookup "
+                          "tables built on first use, instead of evaluating its closed form for "
+                          "every chunk.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&YansErrorRateModel::m_useLookupTable),
+                          MakeBooleanChecker());
     return tid;
 }
 
 YansErrorRateModel::YansErrorRateModel()
+    : m_useLookupTable(false)
 {
 }
 
@@ -142,6 +152,12 @@ YansErrorRateModel::GetFecBpskBer(double snr,
                                   uint32_t adFree) const
 {
     NS_LOG_FUNCTION(this << snr << nbits << signalSpread << phyRate << dFree << adFree);
+    if (m_useLookupTable)
+    {
+        return GetTabulatedChunkSuccessRate({signalSpread, phyRate, 2, dFree, adFree, 0},
+                                            snr,
+                                            nbits);
+    }
     double ber = GetBpskBer(snr, signalSpread, phyRate);
     if (ber == 0.0)
     {
@@ -166,6 +182,13 @@ YansErrorRateModel::GetFecQamBer(double snr,
 {
     NS_LOG_FUNCTION(this << snr << nbits << signalSpread << phyRate << m << dFree << adFree
                          << adFreePlusOne);
+    if (m_useLookupTable)
+    {
+        return GetTabulatedChunkSuccessRate(
+            {signalSpread, phyRate, m, dFree, adFree, adFreePlusOne},
+            snr,
+            nbits);
+    }
     double ber = GetQamBer(snr, m, signalSpread, phyRate);
     if (ber == 0.0)
     {
@@ -182,6 +205,45 @@ YansErrorRateModel::GetFecQamBer(double snr,
     return pms;
 }
 
+double
+YansErrorRateModel::GetCodedBer(const FecParameters& params, double snr) const
+{
+    const auto& [signalSpread, phyRate, m, dFree, adFree, adFreePlusOne] = params;
+    double ber = (m == 2) ? GetBpskBer(snr, signalSpread, phyRate)
+                          : GetQamBer(snr, m, signalSpread, phyRate);
+    if (ber == 0.0)
+    {
+        return 0.0;
+    }
+    double pmu = adFree * CalculatePd(ber, dFree);
+    if (m != 2)
+    {
+        pmu += adFreePlusOne * CalculatePd(ber, dFree + 1);
+    }
+    return std::min(pmu, 1.0);
+}
+
+double
+YansErrorRateModel::GetTabulatedChunkSuccessRate(const FecParameters& params,
+                                                 double snr,
+                                                 uint64_t nbits) const
+{
+    NS_LOG_FUNCTION(this << snr << nbits);
+    auto it = m_lookupTables.find(params);
+    if (it == m_lookupTables.end())
+    {
+        NS_LOG_DEBUG("Build coded BER table for " << std::get<2>(params) << "-QAM at "
+                                                  << std::get<1>(params) << " bps");
+        it = m_lookupTables
+                 .emplace(params,
+                          ErrorRateLookupTable(
+                              [this, params](double x) { return GetCodedBer(params, x); }))
+                 .first;
+    }
+    const auto pmu = it->second.Get(snr);
+    return (pmu == 0.0) ? 1.0 : std::pow(1 - pmu, nbits);
+}
+
 double
 YansErrorRateModel::DoGetChunkSuccessRate(WifiMode mode,
                                           const WifiTxVector& txVector,
@@ -9,8 +9,12 @@
 #ifndef YANS_ERROR_RATE_MODEL_H
 #define YANS_ERROR_RATE_MODEL_H
 
+#include "error-rate-lookup-table.h"
 #include "error-rate-model.h"
 
+#include <map>
+#include <tuple>
+
 namespace ns3
 {
 
@@ -38,6 +42,11 @@ namespace ns3
  *      57(2):440-449, February 2009.
  *    - More detailed description and validation can be found in
  *      http://www.nsnam.org/~pei/80211b.pdf
+ *
+ * When the UseLookupTable attribute is set, the coded bit error rate of the OFDM
+ * modulations is tabulated the first time each combination of signal spread, PHY
+ * rate and code parameters is needed and interpolated afterwards (see
+ * ErrorRateLookupTable), rather than evaluated from its closed form for every chunk.
  */
 class YansErrorRateModel : public ErrorRateModel
 {
@@ -154,6 +163,31 @@ class YansErrorRateModel : public ErrorRateModel
                         uint32_t dfree,
                         uint32_t adFree,
                         uint32_t adFreePlusOne) const;
+
+    /// Signal spread, PHY rate, constellation size (2 for BPSK), dFree, adFree and adFreePlusOne
+    using FecParameters = std::tuple<MHz_u, uint64_t, uint32_t, uint32_t, uint32_t, uint32_t>;
+
+    /**
+     * @param params the parameters of the modulation and of the code
+     * @param snr SNR ratio (not dB)
+     *
+     * @return the coded BER, capped to 1
+     */
+    double GetCodedBer(const FecParameters& params, double snr) const;
+    /**
+     * @param params the parameters of the modulation and of the code
+     * @param snr SNR ratio (not dB)
+     * @param nbits the number of bits in the chunk
+     *
+     * @return the chunk success rate, using the coded BER interpolated from a lookup table
+     */
+    double GetTabulatedChunkSuccessRate(const FecParameters& params,
+                                        double snr,
+                                        uint64_t nbits) const;
+
+    bool m_useLookupTable; //!< whether to interpolate the coded BER from lookup tables
+    mutable std::map<FecParameters, ErrorRateLookupTable>
+        m_lookupTables; //!< coded BER tables indexed by modulation and code parameters
 };
 
 } // namespace ns3
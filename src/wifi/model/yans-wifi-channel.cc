@@ -14,7 +14,9 @@
 #include "wifi-utils.h"
 #include "yans-wifi-phy.h"
 
+#include "ns3/double.h"
 #include "ns3/log.h"
+#include "ns3/mobility-grid-index.h"
 #include "ns3/mobility-model.h"
 #include "ns3/node.h"
 #include "ns3/pointer.h"
@@ -22,6 +24,8 @@
 #include "ns3/propagation-loss-model.h"
 #include "ns3/simulator.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -46,7 +50,14 @@ YansWifiChannel::GetTypeId()
                           "A pointer to the propagation delay model attached to this channel.",
                           PointerValue(),
                           MakePointerAccessor(&YansWifiChannel::m_delay),
-                          MakePointerChecker<PropagationDelayModel>());
+                          MakePointerChecker<PropagationDelayModel>())
+            .AddAttribute("MaxRange",
+                          "If positive, the PHYs farther than this distance (in meters) from the "
+                          "sender are not reached by its transmissions, and the propagation "
+                          "models are not evaluated for them.",
+                          DoubleValue(0),
+                          MakeDoubleAccessor(&YansWifiChannel::m_maxRange),
+                          MakeDoubleChecker<meter_u>(0));
     return tid;
 }
 
@@ -81,41 +92,73 @@ YansWifiChannel::Send(Ptr<YansWifiPhy> sender, Ptr<const WifiPpdu> ppdu, dBm_u t
     NS_LOG_FUNCTION(this << sender << ppdu << txPower);
     Ptr<MobilityModel> senderMobility = sender->GetMobility();
     NS_ASSERT(senderMobility);
-    for (auto i = m_phyList.begin(); i != m_phyList.end(); i++)
+
+    std::vector<Ptr<YansWifiPhy>> receivers;
+    auto addReceiver = [&](const Ptr<YansWifiPhy>& phy) {
+        // For now don't account for inter channel interference nor channel bonding
+        if (phy != sender && phy->GetChannelNumber() == sender->GetChannelNumber())
+        {
+            receivers.push_back(phy);
+        }
+    };
+    if (m_maxRange > 0)
     {
-        if (sender != (*i))
+        if (!m_rxIndex)
         {
-            // For now don't account for inter channel interference nor channel bonding
-            if ((*i)->GetChannelNumber() != sender->GetChannelNumber())
+            m_rxIndex = Create<MobilityGridIndex>(m_maxRange);
+            for (const auto& phy : m_phyList)
             {
-                continue;
+                m_rxIndex->Add(phy->GetMobility());
             }
+        }
+        // the indices are returned in increasing order, hence receptions are
+        // scheduled in the same order as without range limit
+        for (auto i : m_rxIndex->GetItemsInRange(senderMobility, m_maxRange))
+        {
+            addReceiver(m_phyList[i]);
+        }
+    }
+    else
+    {
+        std::for_each(m_phyList.cbegin(), m_phyList.cend(), addReceiver);
+    }
 
-            auto receiverMobility = (*i)->GetMobility()->GetObject<MobilityModel>();
-            const auto delay = m_delay->GetDelay(senderMobility, receiverMobility);
-            const dBm_u rxPower{m_loss->CalcRxPower(txPower, senderMobility, receiverMobility)};
-            NS_LOG_DEBUG("propagation: txPower="
-                         << txPower << "dBm, rxPower=" << rxPower << "dBm, "
-                         << "distance=" << senderMobility->GetDistanceFrom(receiverMobility)
-                         << "m, delay=" << delay);
-            auto dstNetDevice = (*i)->GetDevice();
-            uint32_t dstNode;
-            if (!dstNetDevice)
-            {
-                dstNode = 0xffffffff;
-            }
-            else
-            {
-                dstNode = dstNetDevice->GetNode()->GetId();
-            }
+    std::vector<Ptr<MobilityModel>> receiverMobilities;
+    receiverMobilities.reserve(receivers.size());
+    for (const auto& receiver : receivers)
+    {
+        receiverMobilities.push_back(receiver->GetMobility()->GetObject<MobilityModel>());
+    }
+    // evaluate the propagation loss of all the receivers at once
+    std::vector<double> rxPowers;
+    m_loss->CalcRxPowerBatch(txPower, senderMobility, receiverMobilities, rxPowers);
 
-            Simulator::ScheduleWithContext(dstNode,
-                                           delay,
-                                           &YansWifiChannel::Receive,
-                                           (*i),
-                                           ppdu,
-                                           rxPower);
+    for (std::size_t i = 0; i < receivers.size(); ++i)
+    {
+        const auto& receiverMobility = receiverMobilities[i];
+        const auto delay = m_delay->GetDelay(senderMobility, receiverMobility);
+        const dBm_u rxPower{rxPowers[i]};
+        NS_LOG_DEBUG("propagation: txPower="
+                     << txPower << "dBm, rxPower=" << rxPower << "dBm, "
+                     << "distance=" << senderMobility->GetDistanceFrom(receiverMobility)
+                     << "m, delay=" << delay);
+        auto dstNetDevice = receivers[i]->GetDevice();
+        uint32_t dstNode;
+        if (!dstNetDevice)
+        {
+            dstNode = 0xffffffff;
         }
+        else
+        {
+            dstNode = dstNetDevice->GetNode()->GetId();
+        }
+
+        Simulator::ScheduleWithContext(dstNode,
+                                       delay,
+                                       &YansWifiChannel::Receive,
+                                       receivers[i],
+                                       ppdu,
+                                       rxPower);
     }
 }
 
@@ -158,6 +201,7 @@ YansWifiChannel::Add(Ptr<YansWifiPhy> phy)
 {
     NS_LOG_FUNCTION(this << phy);
     m_phyList.push_back(phy);
+    m_rxIndex = nullptr;
 }
 
 int64_t
@@ -16,6 +16,7 @@
 namespace ns3
 {
 
+class MobilityGridIndex;
 class NetDevice;
 class PropagationLossModel;
 class PropagationDelayModel;
@@ -32,6 +33,14 @@ class WifiPpdu;
  * class and supports an ns3::PropagationLossModel and an
  * ns3::PropagationDelayModel.  By default, no propagation models are set;
  * it is the caller's responsibility to set them before using the channel.
+ *
+ * If the MaxRange attribute is set, the PHYs farther than MaxRange from
+ * the sender are skipped without evaluating the propagation models, which
+ * are only called for the PHYs in range; these are found through a
+ * MobilityGridIndex, so that the cost of a transmission depends on the
+ * density of PHYs rather than on their total number. This assumes that
+ * MaxRange is large enough for the signal to be below the RX sensitivity
+ * of every PHY beyond it.
  */
 class YansWifiChannel : public Channel
 {
@@ -107,6 +116,8 @@ class YansWifiChannel : public Channel
     PhyList m_phyList;                  //!< List of YansWifiPhys connected to this YansWifiChannel
     Ptr<PropagationLossModel> m_loss;   //!< Propagation loss model
     Ptr<PropagationDelayModel> m_delay; //!< Propagation delay model
+    meter_u m_maxRange;                 //!< Maximum range of transmissions (0 means unlimited)
+    mutable Ptr<MobilityGridIndex> m_rxIndex; //!< Spatial index of the PHYs, built on demand
 };
 
 } // namespace ns3
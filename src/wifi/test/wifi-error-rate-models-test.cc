@@ -14,7 +14,9 @@
 #include <gsl/gsl_sf_bessel.h>
 #endif
 
+#include "ns3/boolean.h"
 #include "ns3/dsss-error-rate-model.h"
+#include "ns3/eht-phy.h"
 #include "ns3/he-phy.h" //includes HT and VHT
 #include "ns3/interference-helper.h"
 #include "ns3/log.h"
@@ -1102,6 +1104,84 @@ TableBasedErrorRateTestCase::DoRun()
     }
 }
 
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief Check that the lookup tables of an analytic error rate model closely
+ * follow the closed form they interpolate
+ */
+class ErrorRateLookupTableTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * @param model the TypeId name of the error rate model to test
+     */
+    ErrorRateLookupTableTestCase(const std::string& model);
+
+  private:
+    void DoRun() override;
+
+    std::string m_model; ///< The TypeId name of the error rate model to test
+};
+
+ErrorRateLookupTableTestCase::ErrorRateLookupTableTestCase(const std::string& model)
+    : TestCase("Check the lookup tables of " + model + " against the closed form"),
+      m_model(model)
+{
+}
+
+void
+ErrorRateLookupTableTestCase::DoRun()
+{
+    ObjectFactory factory(m_model);
+    auto analytic = factory.Create<ErrorRateModel>();
+    factory.Set("UseLookupTable", BooleanValue(true));
+    auto tabulated = factory.Create<ErrorRateModel>();
+
+    const std::vector<WifiMode> modes{WifiMode("OfdmRate6Mbps"),
+                                      WifiMode("OfdmRate9Mbps"),
+                                      WifiMode("OfdmRate12Mbps"),
+                                      WifiMode("OfdmRate18Mbps"),
+                                      WifiMode("OfdmRate24Mbps"),
+                                      WifiMode("OfdmRate36Mbps"),
+                                      WifiMode("OfdmRate48Mbps"),
+                                      WifiMode("OfdmRate54Mbps"),
+                                      HtPhy::GetHtMcs5(),
+                                      VhtPhy::GetVhtMcs8(),
+                                      VhtPhy::GetVhtMcs9(),
+                                      HePhy::GetHeMcs10(),
+                                      HePhy::GetHeMcs11(),
+                                      EhtPhy::GetEhtMcs12(),
+                                      EhtPhy::GetEhtMcs13()};
+    for (const auto& mode : modes)
+    {
+        WifiTxVector txVector;
+        txVector.SetMode(mode);
+        for (uint64_t nbits : {24, 1500 * 8, 65535 * 8})
+        {
+            // the SNR step is not a multiple of the table step, so as to test interpolated values
+            for (dB_u snr{-12}; snr <= dB_u{65}; snr += dB_u{0.07})
+            {
+                const auto expected =
+                    analytic->GetChunkSuccessRate(mode, txVector, DbToRatio(snr), nbits);
+                const auto actual =
+                    tabulated->GetChunkSuccessRate(mode, txVector, DbToRatio(snr), nbits);
+                NS_LOG_INFO(m_model << " " << mode << " nbits=" << nbits << " snr=" << snr
+                                    << "dB expected=" << expected << " actual=" << actual);
+                NS_TEST_ASSERT_MSG_EQ_TOL(actual,
+                                          expected,
+                                          1e-4,
+                                          "Interpolated success rate of "
+                                              << mode << " too far from closed form at " << snr
+                                              << " dB for " << nbits << " bits");
+            }
+        }
+    }
+}
+
 /**
  * @ingroup wifi-test
  * @ingroup tests
@@ -1120,6 +1200,10 @@ WifiErrorRateModelsTestSuite::WifiErrorRateModelsTestSuite()
     AddTestCase(new WifiErrorRateModelsTestCaseDsss, TestCase::Duration::QUICK);
     AddTestCase(new WifiErrorRateModelsTestCaseNist, TestCase::Duration::QUICK);
     AddTestCase(new WifiErrorRateModelsTestCaseMimo, TestCase::Duration::QUICK);
+    AddTestCase(new ErrorRateLookupTableTestCase("ns3::NistErrorRateModel"),
+                TestCase::Duration::QUICK);
+    AddTestCase(new ErrorRateLookupTableTestCase("ns3::YansErrorRateModel"),
+                TestCase::Duration::QUICK);
     AddTestCase(new TableBasedErrorRateTestCase("DefaultTableBasedHtMcs0-1458bytes",
                                                 HtPhy::GetHtMcs0(),
                                                 1458),
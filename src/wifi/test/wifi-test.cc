@@ -21,6 +21,7 @@
 #include "ns3/header-serialization-test.h"
 #include "ns3/ht-configuration.h"
 #include "ns3/interference-helper.h"
+#include "ns3/link-sinr-interference-helper.h"
 #include "ns3/mgt-headers.h"
 #include "ns3/mobility-helper.h"
 #include "ns3/multi-model-spectrum-channel.h"
@@ -28,7 +29,9 @@
 #include "ns3/packet-socket-helper.h"
 #include "ns3/packet-socket-server.h"
 #include "ns3/pointer.h"
+#include "ns3/propagation-delay-model.h"
 #include "ns3/propagation-loss-model.h"
+#include "ns3/rectangle.h"
 #include "ns3/rng-seed-manager.h"
 #include "ns3/socket.h"
 #include "ns3/spectrum-wifi-helper.h"
@@ -3961,6 +3964,249 @@ DsssModulationTest::DoRun()
     NS_TEST_ASSERT_MSG_EQ(m_received, 4, "Did not receive four DSSS packets");
 }
 
+//-----------------------------------------------------------------------------
+
+/**
+ * Make sure that setting the MaxRange attribute of a channel only skips the
+ * PHYs that are out of range.
+ *
+ * Mobile adhoc stations periodically send broadcast frames over a channel
+ * whose propagation loss model is a RangePropagationLossModel. The frames
+ * received by every station when the MaxRange attribute of the channel is
+ * set to the range of the propagation loss model must be the same as when
+ * MaxRange is not set.
+ */
+class ChannelMaxRangeTest : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     * @param useSpectrum whether to use a MultiModelSpectrumChannel rather than a YansWifiChannel
+     */
+    ChannelMaxRangeTest(bool useSpectrum);
+    void DoRun() override;
+
+  private:
+    /**
+     * Run a simulation
+     * @param maxRange the value of the MaxRange attribute of the channel
+     * @return the time and the context of every MAC reception
+     */
+    std::vector<std::pair<Time, std::string>> RunOne(meter_u maxRange);
+
+    bool m_useSpectrum; ///< whether to use a MultiModelSpectrumChannel
+};
+
+ChannelMaxRangeTest::ChannelMaxRangeTest(bool useSpectrum)
+    : TestCase(std::string("Check the MaxRange attribute of the ") +
+               (useSpectrum ? "MultiModelSpectrumChannel" : "YansWifiChannel")),
+      m_useSpectrum(useSpectrum)
+{
+}
+
+std::vector<std::pair<Time, std::string>>
+ChannelMaxRangeTest::RunOne(meter_u maxRange)
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+    const meter_u range{150};
+
+    NodeContainer nodes(30);
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211a);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager");
+    WifiMacHelper mac;
+    mac.SetType("ns3::AdhocWifiMac");
+    auto loss = CreateObject<RangePropagationLossModel>();
+    loss->SetAttribute("MaxRange", DoubleValue(range));
+    NetDeviceContainer devices;
+    if (m_useSpectrum)
+    {
+        auto channel = CreateObject<MultiModelSpectrumChannel>();
+        channel->AddPropagationLossModel(loss);
+        channel->SetPropagationDelayModel(CreateObject<ConstantSpeedPropagationDelayModel>());
+        channel->SetAttribute("MaxRange", DoubleValue(maxRange));
+        SpectrumWifiPhyHelper phy;
+        phy.SetChannel(channel);
+        devices = wifi.Install(phy, mac, nodes);
+    }
+    else
+    {
+        auto channel = CreateObject<YansWifiChannel>();
+        channel->SetPropagationLossModel(loss);
+        channel->SetPropagationDelayModel(CreateObject<ConstantSpeedPropagationDelayModel>());
+        channel->SetAttribute("MaxRange", DoubleValue(maxRange));
+        YansWifiPhyHelper phy;
+        phy.SetChannel(channel);
+        devices = wifi.Install(phy, mac, nodes);
+    }
+    WifiHelper::AssignStreams(devices, 100);
+
+    MobilityHelper mobility;
+    mobility.SetPositionAllocator("ns3::RandomRectanglePositionAllocator",
+                                  "X",
+                                  StringValue("ns3::UniformRandomVariable[Min=0|Max=600]"),
+                                  "Y",
+                                  StringValue("ns3::UniformRandomVariable[Min=0|Max=600]"));
+    mobility.SetMobilityModel("ns3::RandomWalk2dMobilityModel",
+                              "Bounds",
+                              RectangleValue(Rectangle(0, 600, 0, 600)),
+                              "Speed",
+                              StringValue("ns3::ConstantRandomVariable[Constant=30]"),
+                              "Time",
+                              TimeValue(Seconds(0.2)),
+                              "Mode",
+                              StringValue("Time"));
+    mobility.Install(nodes);
+
+    std::vector<std::pair<Time, std::string>> receptions;
+    Config::Connect("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Mac/$ns3::WifiMac/MacRx",
+                    Callback<void, std::string, Ptr<const Packet>>(
+                        [&](std::string context, Ptr<const Packet>) {
+                            receptions.emplace_back(Simulator::Now(), context);
+                        }));
+
+    for (uint32_t i = 0; i < 40; ++i)
+    {
+        for (uint32_t j = 0; j < nodes.GetN(); ++j)
+        {
+            Simulator::Schedule(MilliSeconds(50 * i + j),
+                                &NetDevice::Send,
+                                devices.Get(j),
+                                Create<Packet>(100),
+                                Mac48Address::GetBroadcast(),
+                                0);
+        }
+    }
+
+    Simulator::Stop(Seconds(2.1));
+    Simulator::Run();
+    Simulator::Destroy();
+    return receptions;
+}
+
+void
+ChannelMaxRangeTest::DoRun()
+{
+    const auto expected = RunOne(0);
+    NS_TEST_ASSERT_MSG_GT(expected.size(), 0, "No frame received");
+    NS_TEST_ASSERT_MSG_LT(expected.size(), 40 * 30 * 29, "Every station reached every other");
+    NS_TEST_EXPECT_MSG_EQ((RunOne(150) == expected), true, "Unexpected receptions with MaxRange");
+}
+
+/**
+ * Make sure that the LinkSinrInterferenceHelper leaves receptions unchanged
+ * in the absence of interference, and that its collision model is never more
+ * favorable than the SINR integration of the InterferenceHelper.
+ *
+ * Two adhoc stations that are hidden from each other periodically send
+ * broadcast frames to a third one, with a MatrixPropagationLossModel. When
+ * their frames do not overlap, the frames received by the third station must
+ * be the same with both interference helpers; when they overlap, the
+ * LinkSinrInterferenceHelper must not deliver more frames.
+ */
+class LinkSinrInterferenceHelperTest : public TestCase
+{
+  public:
+    LinkSinrInterferenceHelperTest();
+    void DoRun() override;
+
+  private:
+    /**
+     * Run a simulation
+     * @param interferenceHelper the TypeId name of the interference helper to use
+     * @param offset the delay between the frames of the first and the second station
+     * @return the time and the context of every MAC reception
+     */
+    std::vector<std::pair<Time, std::string>> RunOne(const std::string& interferenceHelper,
+                                                     Time offset);
+};
+
+LinkSinrInterferenceHelperTest::LinkSinrInterferenceHelperTest()
+    : TestCase("Check the receptions with the LinkSinrInterferenceHelper")
+{
+}
+
+std::vector<std::pair<Time, std::string>>
+LinkSinrInterferenceHelperTest::RunOne(const std::string& interferenceHelper, Time offset)
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    NodeContainer nodes(3);
+    MobilityHelper mobility;
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(nodes);
+    auto loss = CreateObject<MatrixPropagationLossModel>();
+    loss->SetDefaultLoss(200);
+    loss->SetLoss(nodes.Get(0)->GetObject<MobilityModel>(),
+                  nodes.Get(2)->GetObject<MobilityModel>(),
+                  70);
+    loss->SetLoss(nodes.Get(1)->GetObject<MobilityModel>(),
+                  nodes.Get(2)->GetObject<MobilityModel>(),
+                  85);
+
+    auto channel = CreateObject<YansWifiChannel>();
+    channel->SetPropagationLossModel(loss);
+    channel->SetPropagationDelayModel(CreateObject<ConstantSpeedPropagationDelayModel>());
+    YansWifiPhyHelper phy;
+    phy.SetChannel(channel);
+    phy.SetInterferenceHelper(interferenceHelper);
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211a);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager",
+                                 "DataMode",
+                                 StringValue("OfdmRate36Mbps"),
+                                 "NonUnicastMode",
+                                 StringValue("OfdmRate36Mbps"));
+    WifiMacHelper mac;
+    mac.SetType("ns3::AdhocWifiMac");
+    auto devices = wifi.Install(phy, mac, nodes);
+    WifiHelper::AssignStreams(devices, 100);
+
+    std::vector<std::pair<Time, std::string>> receptions;
+    Config::Connect("/NodeList/2/DeviceList/*/$ns3::WifiNetDevice/Mac/$ns3::WifiMac/MacRx",
+                    Callback<void, std::string, Ptr<const Packet>>(
+                        [&](std::string context, Ptr<const Packet>) {
+                            receptions.emplace_back(Simulator::Now(), context);
+                        }));
+
+    for (uint32_t i = 0; i < 200; ++i)
+    {
+        for (uint32_t j = 0; j < 2; ++j)
+        {
+            Simulator::Schedule(MilliSeconds(5 * i) + j * offset,
+                                &NetDevice::Send,
+                                devices.Get(j),
+                                Create<Packet>(1000),
+                                Mac48Address::GetBroadcast(),
+                                0);
+        }
+    }
+
+    Simulator::Stop(Seconds(1.1));
+    Simulator::Run();
+    Simulator::Destroy();
+    return receptions;
+}
+
+void
+LinkSinrInterferenceHelperTest::DoRun()
+{
+    const auto expected = RunOne("ns3::InterferenceHelper", MilliSeconds(2));
+    NS_TEST_ASSERT_MSG_EQ(expected.size(), 400, "Every frame should be received");
+    NS_TEST_EXPECT_MSG_EQ((RunOne("ns3::LinkSinrInterferenceHelper", MilliSeconds(2)) == expected),
+                          true,
+                          "Unexpected receptions without interference");
+
+    const auto integrated = RunOne("ns3::InterferenceHelper", MicroSeconds(100));
+    const auto abstracted = RunOne("ns3::LinkSinrInterferenceHelper", MicroSeconds(100));
+    NS_TEST_EXPECT_MSG_GT(abstracted.size(), 0, "No frame received with collisions");
+    NS_TEST_EXPECT_MSG_LT_OR_EQ(abstracted.size(),
+                                integrated.size(),
+                                "The collision model is more favorable than SINR integration");
+}
+
 /**
  * @ingroup wifi-test
  * @ingroup tests
@@ -3995,6 +4241,9 @@ WifiTestSuite::WifiTestSuite()
     AddTestCase(new HeRuMcsDataRateTestCase, TestCase::Duration::QUICK);
     AddTestCase(new WifiMgtHeaderTest, TestCase::Duration::QUICK);
     AddTestCase(new DsssModulationTest, TestCase::Duration::QUICK);
+    AddTestCase(new ChannelMaxRangeTest(false), TestCase::Duration::QUICK);
+    AddTestCase(new ChannelMaxRangeTest(true), TestCase::Duration::QUICK);
+    AddTestCase(new LinkSinrInterferenceHelperTest, TestCase::Duration::QUICK);
 }
 
 static WifiTestSuite g_wifiTestSuite; ///< the test suite
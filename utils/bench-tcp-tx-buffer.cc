@@ -0,0 +1,229 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+// This program can be used to benchmark the SACK scoreboard operations of
+// TcpTxBuffer with large windows (large bandwidth-delay products), for various
+// window sizes 'n' (in segments). Each received ACK updates the scoreboard and
+// queries it the way TcpSocketBase does during fast recovery. The receive
+// side (TcpRxBuffer) is benchmarked with out-of-order arrivals behind a hole.
+// Sample usage:  ./ns3 run 'bench-tcp-tx-buffer --n=50000'
+
+#include "ns3/command-line.h"
+#include "ns3/packet.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/tcp-header.h"
+#include "ns3/tcp-rx-buffer.h"
+#include "ns3/tcp-tx-buffer.h"
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <stdlib.h> // for exit ()
+
+using namespace ns3;
+
+/// Segment size used by the benchmark
+static const uint32_t SEGMENT_SIZE = 1448;
+
+/// Receiver window callback, never limiting
+static uint32_t
+GetRWnd()
+{
+    return std::numeric_limits<uint32_t>::max();
+}
+
+/**
+ * Fill a buffer and transmit a full window of n segments.
+ * @param n the window size in segments
+ * @return the buffer
+ */
+static Ptr<TcpTxBuffer>
+FillWindow(uint32_t n)
+{
+    Ptr<TcpTxBuffer> txBuf = CreateObject<TcpTxBuffer>();
+    txBuf->SetRWndCallback(MakeCallback(&GetRWnd));
+    txBuf->SetMaxBufferSize(n * SEGMENT_SIZE);
+    txBuf->SetSegmentSize(SEGMENT_SIZE);
+    txBuf->SetDupAckThresh(3);
+    txBuf->SetHeadSequence(SequenceNumber32(1));
+    txBuf->Add(Create<Packet>(n * SEGMENT_SIZE));
+    SequenceNumber32 seq(1);
+    for (uint32_t i = 0; i < n; i++)
+    {
+        txBuf->CopyFromSequence(SEGMENT_SIZE, seq);
+        seq += SEGMENT_SIZE;
+    }
+    return txBuf;
+}
+
+/**
+ * Process one ACK carrying the given SACK blocks, as in fast recovery.
+ * @param txBuf the buffer
+ * @param sackList the SACK blocks
+ */
+static void
+ProcessAck(Ptr<TcpTxBuffer> txBuf, const TcpOptionSack::SackList& sackList)
+{
+    SequenceNumber32 next;
+    SequenceNumber32 nextHigh;
+    txBuf->Update(sackList);
+    txBuf->BytesInFlight();
+    txBuf->IsLost(txBuf->HeadSequence());
+    txBuf->NextSeg(&next, &nextHigh, true);
+}
+
+/**
+ * The first segment of the window is lost, and every following segment is
+ * SACKed, one per ACK, in a single growing block.
+ * @param n the window size in segments
+ * @return the number of ACKs processed
+ */
+static uint32_t
+BenchSingleLoss(uint32_t n)
+{
+    Ptr<TcpTxBuffer> txBuf = FillWindow(n);
+    SequenceNumber32 head = txBuf->HeadSequence();
+    for (uint32_t i = 2; i <= n; i++)
+    {
+        TcpOptionSack::SackList sackList;
+        sackList.emplace_back(head + SEGMENT_SIZE, head + i * SEGMENT_SIZE);
+        ProcessAck(txBuf, sackList);
+    }
+    txBuf->DiscardUpTo(head + n * SEGMENT_SIZE);
+    return n - 1;
+}
+
+/**
+ * One segment every ten is lost; each ACK reports the three most recent SACK
+ * blocks.
+ * @param n the window size in segments
+ * @return the number of ACKs processed
+ */
+static uint32_t
+BenchPeriodicLoss(uint32_t n)
+{
+    Ptr<TcpTxBuffer> txBuf = FillWindow(n);
+    SequenceNumber32 head = txBuf->HeadSequence();
+    uint32_t acks = 0;
+    for (uint32_t i = 1; i < n; i++)
+    {
+        if (i % 10 == 0)
+        {
+            continue;
+        }
+        TcpOptionSack::SackList sackList;
+        uint32_t blockStart = (i / 10) * 10 + 1;
+        sackList.emplace_back(head + blockStart * SEGMENT_SIZE, head + (i + 1) * SEGMENT_SIZE);
+        for (uint32_t b = 1; b < 3 && blockStart > 10 * b; b++)
+        {
+            uint32_t start = blockStart - 10 * b;
+            sackList.emplace_back(head + start * SEGMENT_SIZE, head + (start + 9) * SEGMENT_SIZE);
+        }
+        ProcessAck(txBuf, sackList);
+        acks++;
+    }
+    txBuf->DiscardUpTo(head + n * SEGMENT_SIZE);
+    return acks;
+}
+
+/**
+ * One segment every ten is lost and all the others are SACKed. The
+ * retransmissions then fill the holes in the middle of the window, one per
+ * ACK, while the retransmission of the first hole is lost again, so that the
+ * cumulative ACK never advances.
+ * @param n the window size in segments
+ * @return the number of ACKs processed
+ */
+static uint32_t
+BenchHoleFill(uint32_t n)
+{
+    Ptr<TcpTxBuffer> txBuf = FillWindow(n);
+    SequenceNumber32 head = txBuf->HeadSequence();
+    TcpOptionSack::SackList allBlocks;
+    for (uint32_t start = 1; start < n; start += 10)
+    {
+        allBlocks.emplace_back(head + start * SEGMENT_SIZE,
+                               head + std::min(start + 9, n) * SEGMENT_SIZE);
+    }
+    ProcessAck(txBuf, allBlocks);
+
+    uint32_t acks = 1;
+    for (uint32_t hole = 10; hole < n; hole += 10)
+    {
+        // The block starting after the first hole now extends past this one
+        TcpOptionSack::SackList sackList;
+        uint32_t end = std::min(hole + 10, n);
+        sackList.emplace_back(head + SEGMENT_SIZE, head + end * SEGMENT_SIZE);
+        ProcessAck(txBuf, sackList);
+        acks++;
+    }
+    txBuf->DiscardUpTo(head + n * SEGMENT_SIZE);
+    return acks;
+}
+
+/**
+ * The first segment of the window is lost, and the receiver gets all the
+ * following ones out of order before the retransmission fills the hole.
+ * @param n the window size in segments
+ * @return the number of segments received
+ */
+static uint32_t
+BenchRxOutOfOrder(uint32_t n)
+{
+    Ptr<TcpRxBuffer> rxBuf = CreateObject<TcpRxBuffer>(1);
+    rxBuf->SetMaxBufferSize(n * SEGMENT_SIZE);
+    TcpHeader tcpHeader;
+    for (uint32_t i = 1; i < n; i++)
+    {
+        tcpHeader.SetSequenceNumber(SequenceNumber32(1 + i * SEGMENT_SIZE));
+        rxBuf->Add(Create<Packet>(SEGMENT_SIZE), tcpHeader);
+    }
+    tcpHeader.SetSequenceNumber(SequenceNumber32(1));
+    rxBuf->Add(Create<Packet>(SEGMENT_SIZE), tcpHeader);
+    return n;
+}
+
+/**
+ * Run a benchmark and print the number of ACKs (or segments) processed per second.
+ * @param bench the benchmark function
+ * @param n the window size in segments
+ * @param name the benchmark name
+ */
+static void
+RunBench(uint32_t (*bench)(uint32_t), uint32_t n, const char* name)
+{
+    SystemWallClockMs time;
+    time.Start();
+    uint32_t events = (*bench)(n);
+    uint64_t deltaMs = time.End();
+    double eventsPerSecond = deltaMs > 0 ? events * 1000.0 / deltaMs : 0;
+    std::cout << eventsPerSecond << " events/s (" << deltaMs << " ms elapsed)\t" << name
+              << std::endl;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t n = 0;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark TcpTxBuffer SACK scoreboard");
+    cmd.AddValue("n", "window size, in segments", n);
+    cmd.Parse(argc, argv);
+
+    if (n == 0)
+    {
+        std::cerr << "Error-- window size must be specified "
+                  << "by command-line argument --n=(number of segments)" << std::endl;
+        exit(1);
+    }
+    std::cout << "Running bench-tcp-tx-buffer with n=" << n << std::endl;
+
+    RunBench(&BenchSingleLoss, n, "Single loss, one growing SACK block");
+    RunBench(&BenchPeriodicLoss, n, "One loss every ten segments, three SACK blocks");
+    RunBench(&BenchHoleFill, n, "Retransmissions filling holes in the middle of the window");
+    RunBench(&BenchRxOutOfOrder, n, "Receiver, out-of-order segments behind a hole");
+
+    return 0;
+}